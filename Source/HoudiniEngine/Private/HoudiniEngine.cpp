@@ -37,7 +37,11 @@
 #include "HoudiniEngineManager.h"
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
+#include "HoudiniAsset.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniEngineRuntime.h"
+#include "HoudiniInstanceTranslator.h"
+#include "HoudiniParameterTranslator.h"
 #include "HAPI/HAPI_Version.h"
 
 #include "Modules/ModuleManager.h"
@@ -48,6 +52,7 @@
 #include "HAL/PlatformFilemanager.h"
 #include "Async/Async.h"
 #include "Logging/LogMacros.h"
+#include "AssetRegistryModule.h"
 
 #if WITH_EDITOR
 	#include "Widgets/Notifications/SNotificationList.h"
@@ -216,6 +221,17 @@ FHoudiniEngine::StartupModule()
 	// Initialize the singleton with this instance
 	FHoudiniEngine::HoudiniEngineInstance = this;
 
+	// Objects resolved from attribute paths are cached, invalidate them when assets are renamed or removed
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRemovedCallback = AssetRegistry.OnAssetRemoved().AddLambda([](const FAssetData&)
+	{
+		FHoudiniEngineUtils::ClearResolvedObjectPathCache();
+	});
+	AssetRenamedCallback = AssetRegistry.OnAssetRenamed().AddLambda([](const FAssetData&, const FString&)
+	{
+		FHoudiniEngineUtils::ClearResolvedObjectPathCache();
+	});
+
 	// See if we need to start the manager ticking if needed
 	// Don tick if we failed to load HAPI, if cooking is disabled or if we're using a null session
 	if (FHoudiniApi::IsHAPIInitialized())
@@ -273,6 +289,9 @@ FHoudiniEngine::ShutdownModule()
 		HoudiniDefaultReferenceMeshMaterial->RemoveFromRoot();
 		HoudiniDefaultReferenceMeshMaterial = nullptr;
 	}
+
+	// Remove the ticker spawning the instanced actors that didn't fit in their cook's budget
+	FHoudiniInstanceTranslator::ClearPendingInstanceActorSpawns();
 	/*
 	// We no longer need Houdini digital asset used for loading bgeo files.
 	if (HoudiniBgeoAsset.IsValid())
@@ -318,6 +337,15 @@ FHoudiniEngine::ShutdownModule()
 		HoudiniEngineManager = nullptr;
 	}
 
+	// Unregister the asset registry callbacks
+	if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.OnAssetRemoved().Remove(AssetRemovedCallback);
+		AssetRegistry.OnAssetRenamed().Remove(AssetRenamedCallback);
+	}
+	FHoudiniEngineUtils::ClearResolvedObjectPathCache();
+
 	// Perform HAPI finalization.
 	if ( FHoudiniApi::IsHAPIInitialized() )
 	{
@@ -344,6 +372,15 @@ FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 	TaskInfos.Add(InTask.HapiGUID, TaskInfo);
 }
 
+bool
+FHoudiniEngine::InterruptCookingTask(const FGuid& InHapiGUID)
+{
+	if (!HoudiniEngineScheduler)
+		return false;
+
+	return HoudiniEngineScheduler->InterruptCookingTask(InHapiGUID);
+}
+
 void
 FHoudiniEngine::AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo)
 {
@@ -372,6 +409,100 @@ FHoudiniEngine::RetrieveTaskInfo(const FGuid& InHapiGUID, FHoudiniEngineTaskInfo
 	return false;
 }
 
+bool
+FHoudiniEngine::FindLoadedAssetLibrary(const FString& InLibraryKey, HAPI_AssetLibraryId& OutAssetLibraryId)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	HAPI_AssetLibraryId* FoundLibraryId = LoadedAssetLibraries.Find(InLibraryKey);
+	if (!FoundLibraryId)
+		return false;
+
+	OutAssetLibraryId = *FoundLibraryId;
+	return true;
+}
+
+void
+FHoudiniEngine::AddLoadedAssetLibrary(const FString& InLibraryKey, const HAPI_AssetLibraryId& InAssetLibraryId)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	LoadedAssetLibraries.Add(InLibraryKey, InAssetLibraryId);
+}
+
+void
+FHoudiniEngine::RemoveLoadedAssetLibrary(const FString& InLibraryKey)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	LoadedAssetLibraries.Remove(InLibraryKey);
+}
+
+void
+FHoudiniEngine::ClearLoadedAssetLibraries()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+	LoadedAssetLibraries.Empty();
+	AssetLibraryDefinitions.Empty();
+	AssetDefinitionLibraries.Empty();
+}
+
+void
+FHoudiniEngine::SetAssetLibraryDefinitions(const HAPI_AssetLibraryId& InAssetLibraryId, const TArray<FString>& InAssetNames)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	AssetLibraryDefinitions.Add(InAssetLibraryId, InAssetNames);
+
+	// Libraries are loaded with allow_overwrite, so the last loaded library provides the definitions
+	for (const FString& AssetName : InAssetNames)
+		AssetDefinitionLibraries.Add(AssetName, InAssetLibraryId);
+}
+
+bool
+FHoudiniEngine::AreAssetLibraryDefinitionsCurrent(const HAPI_AssetLibraryId& InAssetLibraryId)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const TArray<FString>* AssetNames = AssetLibraryDefinitions.Find(InAssetLibraryId);
+	if (!AssetNames)
+		return false;
+
+	for (const FString& AssetName : *AssetNames)
+	{
+		const HAPI_AssetLibraryId* DefinitionLibraryId = AssetDefinitionLibraries.Find(AssetName);
+		if (!DefinitionLibraryId || *DefinitionLibraryId != InAssetLibraryId)
+			return false;
+	}
+
+	return true;
+}
+
+void
+FHoudiniEngine::PreloadAssetLibraries()
+{
+	if (!FHoudiniEngineRuntime::IsInitialized())
+		return;
+
+	TSet<UHoudiniAsset*> PreloadedAssets;
+	FHoudiniEngineRuntime& EngineRuntime = FHoudiniEngineRuntime::Get();
+	for (int32 Idx = 0; Idx < EngineRuntime.GetRegisteredHoudiniComponentCount(); Idx++)
+	{
+		UHoudiniAssetComponent* HAC = EngineRuntime.GetRegisteredHoudiniComponentAt(Idx);
+		if (!HAC || HAC->IsPendingKill())
+			continue;
+
+		UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
+		if (!HoudiniAsset || HoudiniAsset->IsPendingKill() || PreloadedAssets.Contains(HoudiniAsset))
+			continue;
+
+		PreloadedAssets.Add(HoudiniAsset);
+
+		// The loaded library is cached, the asset's instantiation will reuse it
+		HAPI_AssetLibraryId AssetLibraryId = -1;
+		if (!FHoudiniEngineUtils::LoadHoudiniAsset(HoudiniAsset, AssetLibraryId))
+			HOUDINI_LOG_WARNING(TEXT("Could not preload the asset library of %s."), *HoudiniAsset->GetName());
+	}
+}
+
 /*
 void
 FHoudiniEngine::AddHoudiniAssetComponent(UHoudiniAssetComponent* HAC)
@@ -706,6 +837,10 @@ FHoudiniEngine::InitializeHAPISession()
 	// Let HAPI know we are running inside UE4
 	FHoudiniApi::SetServerEnvString(&Session, HAPI_ENV_CLIENT_NAME, HAPI_UNREAL_CLIENT_NAME);
 
+	// Libraries loaded by a previous session aren't valid in this one
+	ClearLoadedAssetLibraries();
+	FHoudiniParameterTranslator::ClearParameterTagsCache();
+
 	if (bEnableSessionSync)
 	{
 		// Set the session sync infos if needed
@@ -717,6 +852,10 @@ FHoudiniEngine::InitializeHAPISession()
 		HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine Session Sync enabled."));		
 	}
 
+	// Load the HDAs used in the opened levels now, rather than when they are instantiated
+	if (HoudiniRuntimeSettings->bPreloadAssetLibrariesOnSessionStart)
+		PreloadAssetLibraries();
+
 	return true;
 }
 
@@ -729,6 +868,8 @@ FHoudiniEngine::OnSessionLost()
 	Session.type = HAPI_SESSION_MAX;
 	bEnableSessionSync = false;
 	HoudiniEngineManager->StopHoudiniTicking();
+	ClearLoadedAssetLibraries();
+	FHoudiniParameterTranslator::ClearParameterTagsCache();
 
 	// This indicates that we likely have lost the session due to a crash in HARS/Houdini
 	FString Notification = TEXT("Houdini Engine Session lost!");
@@ -763,6 +904,8 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	bEnableSessionSync = false;
 
 	HoudiniEngineManager->StopHoudiniTicking();
+	ClearLoadedAssetLibraries();
+	FHoudiniParameterTranslator::ClearParameterTagsCache();
 
 	return true;
 }
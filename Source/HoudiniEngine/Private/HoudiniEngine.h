@@ -127,9 +127,27 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		virtual void RemoveTaskInfo(const FGuid& InHapiGUID);
 		// Remove task info.
 		virtual bool RetrieveTaskInfo(const FGuid& InHapiGUID, FHoudiniEngineTaskInfo & OutTaskInfo);
+		// Interrupt a task's cook, if it is the one currently cooking.
+		virtual bool InterruptCookingTask(const FGuid& InHapiGUID);
 		// Register asset to the manager
 		//virtual void AddHoudiniAssetComponent(UHoudiniAssetComponent* HAC);
 
+		// Retrieve the id of an asset library that has already been loaded in the current session.
+		bool FindLoadedAssetLibrary(const FString& InLibraryKey, HAPI_AssetLibraryId& OutAssetLibraryId);
+		// Register an asset library that has been loaded in the current session.
+		void AddLoadedAssetLibrary(const FString& InLibraryKey, const HAPI_AssetLibraryId& InAssetLibraryId);
+		// Remove an asset library that is no longer valid in the current session.
+		void RemoveLoadedAssetLibrary(const FString& InLibraryKey);
+		// Forget all the asset libraries, their ids are only valid in the session that loaded them.
+		void ClearLoadedAssetLibraries();
+		// Register the operators whose definitions are now provided by an asset library.
+		void SetAssetLibraryDefinitions(const HAPI_AssetLibraryId& InAssetLibraryId, const TArray<FString>& InAssetNames);
+		// Returns false if some of an asset library's operators have been redefined by another library since it was loaded.
+		bool AreAssetLibraryDefinitionsCurrent(const HAPI_AssetLibraryId& InAssetLibraryId);
+
+		// Load the HDAs used by all the registered Houdini Asset Components in the current session.
+		void PreloadAssetLibraries();
+
 		// Indicates whether or not cooking is currently enabled
 		bool IsCookingEnabled() const;
 		// Sets whether or not cooking is currently enabled
@@ -235,6 +253,12 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Map of task statuses.
 		TMap<FGuid, FHoudiniEngineTaskInfo> TaskInfos;
 
+		// Asset libraries loaded in the current session, keyed by their file or content hash.
+		TMap<FString, HAPI_AssetLibraryId> LoadedAssetLibraries;
+		// Operators defined by each loaded asset library, and the library providing the current definition of each operator.
+		TMap<HAPI_AssetLibraryId, TArray<FString>> AssetLibraryDefinitions;
+		TMap<FString, HAPI_AssetLibraryId> AssetDefinitionLibraries;
+
 		// Thread used to execute the scheduler.
 		FRunnableThread * HoudiniEngineSchedulerThread;
 		// Scheduler used to schedule HAPI instantiation and cook tasks. 
@@ -299,6 +323,10 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 
 		FDelegateHandle PostEngineInitCallback;
 
+		// Asset registry callbacks used to invalidate the resolved object path cache
+		FDelegateHandle AssetRemovedCallback;
+		FDelegateHandle AssetRenamedCallback;
+
 #if WITH_EDITOR
 		/** Notification used by this component. **/
 		TWeakPtr<class SNotificationItem> NotificationPtr;
@@ -36,9 +36,14 @@
 #include "HoudiniParameterTranslator.h"
 #include "HoudiniPDGManager.h"
 #include "HoudiniInputTranslator.h"
+#include "HoudiniMaterialTranslator.h"
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
 #include "HoudiniSplineTranslator.h"
+#include "HoudiniOutput.h"
+#include "HoudiniInput.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
 
@@ -451,10 +456,21 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 
 		case EHoudiniAssetState::Cooking:
 		{
+			// Don't wait for the current cook to finish if it's already outdated
+			InterruptCookIfNeeded(HAC);
+
 			EHoudiniAssetState NewState = EHoudiniAssetState::Cooking;
 			bool state = UpdateCooking(HAC, NewState);
 			if (state)
 			{
+				// An interrupted cook has failed, go back to None so the latest changes are cooked instead
+				if (InterruptedCookHACs.Remove(HAC) > 0 && NewState == EHoudiniAssetState::PostCook)
+				{
+					HOUDINI_LOG_MESSAGE(TEXT("   %s Cook interrupted by newer changes."), *HAC->GetDisplayName());
+					HAC->bLastCookSuccess = false;
+					NewState = EHoudiniAssetState::None;
+				}
+
 				// We need to update the HAC's state
 				HAC->AssetState = NewState;
 				EnableEditorAutoSave(HAC);
@@ -508,9 +524,13 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			// Do nothing unless the HAC has been updated
 			if (HAC->NeedUpdate())
 			{
-				HAC->bForceNeedUpdate = false;
-				// Update the HAC's state
-				HAC->AssetState = EHoudiniAssetState::PreCook;
+				// Wait for the debounce time so successive changes are cooked together
+				if (HasCookDebounceElapsed(HAC))
+				{
+					HAC->bForceNeedUpdate = false;
+					// Update the HAC's state
+					HAC->AssetState = EHoudiniAssetState::PreCook;
+				}
 			}
 			else if (HAC->NeedTransformUpdate())
 			{
@@ -544,6 +564,9 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 		{
 			StartTaskAssetRebuild(HAC->AssetId, HAC->HapiGUID);
 
+			// The rebuilt outputs shouldn't hold on to the previous material instances
+			FHoudiniMaterialTranslator::ReleaseMaterialInstances(HAC->GetComponentGUID());
+
 			HAC->MarkAsNeedCook();
 			HAC->AssetState = EHoudiniAssetState::PreInstantiation;
 			break;
@@ -555,6 +578,11 @@ FHoudiniEngineManager::ProcessComponent(UHoudiniAssetComponent* HAC)
 			StartTaskAssetDelete(HAC->GetAssetId(), HapiDeletionGUID, true);
 				//HAC->AssetId = -1;
 
+			PendingCookRequestTimes.Remove(HAC);
+			InterruptedCookHACs.Remove(HAC);
+			DetailsLayoutHashes.Remove(HAC);
+			FHoudiniMaterialTranslator::ReleaseMaterialInstances(HAC->GetComponentGUID());
+
 			// Update the HAC's state
 			HAC->AssetState = EHoudiniAssetState::Deleting;
 			break;
@@ -917,6 +945,10 @@ FHoudiniEngineManager::PreCook(UHoudiniAssetComponent* HAC)
 		HAC->UpdatePostDuplicate();
 	}
 
+	// Newly instantiated HACs can reuse the parameters of the asset's other instances
+	if (HAC->GetNumParameters() <= 0)
+		FHoudiniParameterTranslator::InitializeParametersFromTemplates(HAC);
+
 	FHoudiniParameterTranslator::OnPreCookParameters(HAC);
 
 	// Upload the changed/parameters back to HAPI
@@ -1017,8 +1049,9 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 
 		FHoudiniEngine::Get().FinishTaskSlateNotification(FText::FromString("Finished processing outputs"));
 
-		// Trigger a details panel update
-		FHoudiniEngineUtils::UpdateEditorProperties(HAC, true);
+		// Trigger a details panel update, only rebuild it if the displayed objects have changed.
+		// Otherwise, its widgets are refreshed in place.
+		FHoudiniEngineUtils::UpdateEditorProperties(HAC, HasDetailsLayoutChanged(HAC));
 
 		// If any outputs have HoudiniStaticMeshes, and if timer based refinement is enabled on the HAC,
 		// set the RefineMeshesTimer and ensure BuildStaticMeshesForAllHoudiniStaticMeshes is bound to
@@ -1246,6 +1279,115 @@ FHoudiniEngineManager::IsCookingEnabledForHoudiniAsset(UHoudiniAssetComponent* H
 	return false;
 }
 
+bool
+FHoudiniEngineManager::HasCookDebounceElapsed(const UHoudiniAssetComponent* HAC)
+{
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const float DebounceTime = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->CookDebounceTime : 0.0f;
+
+	// Explicit recook/rebuild requests are never delayed
+	if (DebounceTime <= 0.0f || HAC->HasRecookBeenRequested() || HAC->HasRebuildBeenRequested())
+	{
+		PendingCookRequestTimes.Remove(HAC);
+		return true;
+	}
+
+	const double CurrentTime = FPlatformTime::Seconds();
+	double* RequestTime = PendingCookRequestTimes.Find(HAC);
+	if (!RequestTime)
+	{
+		PendingCookRequestTimes.Add(HAC, CurrentTime);
+		return false;
+	}
+
+	// Restart the wait each time a parameter is modified
+	*RequestTime = FMath::Max(*RequestTime, HAC->GetLastParameterChangeTime());
+	if (CurrentTime - *RequestTime < DebounceTime)
+		return false;
+
+	PendingCookRequestTimes.Remove(HAC);
+	return true;
+}
+
+bool
+FHoudiniEngineManager::InterruptCookIfNeeded(const UHoudiniAssetComponent* HAC)
+{
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings || !HoudiniRuntimeSettings->bInterruptCookOnParameterChange)
+		return false;
+
+	// Only interrupt a cook once
+	if (InterruptedCookHACs.Contains(HAC))
+		return false;
+
+	// Parameters uploaded for the current cook are no longer marked as changed,
+	// so this indicates that new values have been set since the cook started
+	if (!HAC->NeedUpdateParameters())
+		return false;
+
+	// Only interrupts the session's cook if it is this HAC's task
+	if (!FHoudiniEngine::Get().InterruptCookingTask(HAC->HapiGUID))
+		return false;
+
+	InterruptedCookHACs.Add(HAC);
+	return true;
+}
+
+bool
+FHoudiniEngineManager::HasDetailsLayoutChanged(UHoudiniAssetComponent* HAC)
+{
+	uint32 LayoutHash = GetTypeHash(HAC->GetNumHandles());
+	LayoutHash = HashCombine(LayoutHash, GetTypeHash(HAC->GetPDGAssetLink()));
+
+	for (UHoudiniInput* CurrentInput : HAC->GetInputs())
+		LayoutHash = HashCombine(LayoutHash, GetTypeHash(CurrentInput));
+
+	for (UHoudiniOutput* CurrentOutput : HAC->GetOutputs())
+	{
+		LayoutHash = HashCombine(LayoutHash, GetTypeHash(CurrentOutput));
+		if (!CurrentOutput || CurrentOutput->IsPendingKill())
+			continue;
+
+		LayoutHash = HashCombine(LayoutHash, GetTypeHash((uint8)CurrentOutput->GetType()));
+		for (const auto& CurrentPair : CurrentOutput->GetOutputObjects())
+		{
+			const FHoudiniOutputObject& CurrentOutputObject = CurrentPair.Value;
+			LayoutHash = HashCombine(LayoutHash, GetTypeHash(CurrentOutputObject.OutputObject));
+			LayoutHash = HashCombine(LayoutHash, GetTypeHash(CurrentOutputObject.OutputComponent));
+			LayoutHash = HashCombine(LayoutHash, GetTypeHash(CurrentOutputObject.ProxyObject));
+			LayoutHash = HashCombine(LayoutHash, GetTypeHash(CurrentOutputObject.ProxyComponent));
+			LayoutHash = HashCombine(LayoutHash, GetTypeHash((uint8)CurrentOutputObject.bProxyIsCurrent));
+
+			// The output meshes' materials, LODs, sockets and colliders are displayed as well
+			UStaticMesh* StaticMesh = Cast<UStaticMesh>(CurrentOutputObject.OutputObject);
+			if (StaticMesh && !StaticMesh->IsPendingKill())
+			{
+				LayoutHash = HashCombine(LayoutHash, GetTypeHash(StaticMesh->GetNumLODs()));
+				LayoutHash = HashCombine(LayoutHash, GetTypeHash(StaticMesh->Sockets.Num()));
+				if (StaticMesh->BodySetup && !StaticMesh->BodySetup->IsPendingKill())
+					LayoutHash = HashCombine(LayoutHash, GetTypeHash(StaticMesh->BodySetup->AggGeom.GetElementCount()));
+
+				for (const FStaticMaterial& CurrentMaterial : StaticMesh->StaticMaterials)
+					LayoutHash = HashCombine(LayoutHash, GetTypeHash(CurrentMaterial.MaterialInterface));
+			}
+		}
+
+		for (const auto& CurrentPair : CurrentOutput->GetInstancedOutputs())
+		{
+			LayoutHash = HashCombine(LayoutHash, GetTypeHash(CurrentPair.Value.OriginalObject));
+			for (const TSoftObjectPtr<UObject>& CurrentVariation : CurrentPair.Value.VariationObjects)
+				LayoutHash = HashCombine(LayoutHash, GetTypeHash(CurrentVariation));
+		}
+	}
+
+	uint32* PreviousLayoutHash = DetailsLayoutHashes.Find(HAC);
+	if (PreviousLayoutHash && *PreviousLayoutHash == LayoutHash)
+		return false;
+
+	DetailsLayoutHashes.Add(HAC, LayoutHash);
+	return true;
+}
+
 void 
 FHoudiniEngineManager::BuildStaticMeshesForAllHoudiniStaticMeshes(UHoudiniAssetComponent* HAC)
 {
@@ -127,6 +127,17 @@ protected:
 
 	bool IsCookingEnabledForHoudiniAsset(UHoudiniAssetComponent* HAC);
 
+	// Returns true if the HAC's cook debounce time has elapsed since it last needed an update
+	bool HasCookDebounceElapsed(const UHoudiniAssetComponent* HAC);
+
+	// Interrupts the HAC's running cook if its parameters have been modified since it started
+	// Returns true if the cook has been interrupted
+	bool InterruptCookIfNeeded(const UHoudiniAssetComponent* HAC);
+
+	// Returns true if the objects displayed in the HAC's details panel (outputs, inputs, handles...)
+	// have changed since the last call, in which case the details panel needs to be rebuilt
+	bool HasDetailsLayoutChanged(UHoudiniAssetComponent* HAC);
+
 	// Syncs the houdini viewport to Unreal's viewport
 	// Returns true if the Houdini viewport has been modified
 	bool SyncHoudiniViewportToUnreal();
@@ -182,4 +193,13 @@ private:
 
 	// Indicates which HACs disable auto-saving
 	TSet<const UHoudiniAssetComponent*> DisableAutoSavingHACs;
+
+	// Time at which the HACs waiting for their cook debounce time first needed an update
+	TMap<const UHoudiniAssetComponent*, double> PendingCookRequestTimes;
+
+	// HACs whose running cook has been interrupted, their results will be discarded
+	TSet<const UHoudiniAssetComponent*> InterruptedCookHACs;
+
+	// Hash of the objects displayed in the HACs details panel after their last cook
+	TMap<const UHoudiniAssetComponent*, uint32> DetailsLayoutHashes;
 };
\ No newline at end of file
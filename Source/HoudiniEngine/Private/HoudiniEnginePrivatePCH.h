@@ -112,6 +112,9 @@
 
 #define HAPI_UNREAL_SCALE_SMALL_VALUE						KINDA_SMALL_NUMBER * 2.0f
 
+// Number of values fetched per GetHeightFieldData call when reading heightfields (4MB of floats)
+#define HAPI_UNREAL_HEIGHTFIELD_FETCH_CHUNK_SIZE			(1024 * 1024)
+
 #define HAPI_UNREAL_DEFAULT_MATERIAL_NAME                   TEXT( "default_material" )
 
 // Attributes
@@ -186,6 +189,7 @@
 #define HAPI_UNREAL_ATTRIB_INSTANCE_COLOR					"unreal_instance_color"
 #define HAPI_UNREAL_ATTRIB_SPLIT_ATTR						"unreal_split_attr"
 #define HAPI_UNREAL_ATTRIB_HIERARCHICAL_INSTANCED_SM		"unreal_hierarchical_instancer"
+#define HAPI_UNREAL_ATTRIB_INSTANCER_CELL_SIZE				"unreal_instancer_cell_size"
 
 
 #define HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME				 HAPI_ATTRIB_NAME
@@ -272,6 +276,7 @@
 #define HAPI_UNREAL_PACKAGE_META_NODE_PATH                      TEXT( "HoudiniNodePath" )
 #define HAPI_UNREAL_PACKAGE_META_BAKE_COUNTER                   TEXT( "HoudiniPackageBakeCounter" )
 #define HAPI_UNREAL_PACKAGE_META_TEMP_GUID                      TEXT( "HoudiniPackageTempGUID" )
+#define HAPI_UNREAL_PACKAGE_META_TEXTURE_HASH                   TEXT( "HoudiniTextureHash" )
 
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL       TEXT( "N" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE      TEXT( "C_A" )
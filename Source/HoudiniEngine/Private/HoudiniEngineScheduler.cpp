@@ -42,6 +42,7 @@ FHoudiniEngineScheduler::FHoudiniEngineScheduler()
 	, PositionWrite(0u)
 	, PositionRead(0u)
 	, bStopping(false)
+	, bCookingTaskInterrupted(false)
 {
 	//  Make sure size is power of two.
 	TaskCount = FPlatformMath::RoundUpToPowerOfTwo(FHoudiniEngineScheduler::InitialTaskSize);
@@ -288,11 +289,18 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		return;
 	}
 
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		CookingTaskGUID = Task.HapiGUID;
+		bCookingTaskInterrupted = false;
+	}
+
 	// Default CookOptions
 	HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
 	Result = FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), AssetId, &CookOptions);
 	if (Result != HAPI_RESULT_SUCCESS)
 	{
+		FinishCookingTask();
 		AddResponseMessageTaskInfo(
 			Result, EHoudiniEngineTaskType::AssetCooking,
 			EHoudiniEngineTaskState::FinishedWithFatalError,
@@ -318,6 +326,23 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 		HOUDINI_CHECK_ERROR_GET( &Result, FHoudiniApi::GetStatus(
 			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
 
+		if (Status == HAPI_STATE_READY
+			|| Status == HAPI_STATE_READY_WITH_FATAL_ERRORS
+			|| Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
+		{
+			if (FinishCookingTask())
+			{
+				// The cook has been interrupted, its results are incomplete
+				AddResponseMessageTaskInfo(
+					HAPI_RESULT_SUCCESS,
+					EHoudiniEngineTaskType::AssetCooking,
+					EHoudiniEngineTaskState::Aborted,
+					AssetId, Task, TEXT("Cooking Interrupted"));
+
+				break;
+			}
+		}
+
 		if (Status == HAPI_STATE_READY)
 		{
 			// Cooking has been successful.
@@ -367,6 +392,37 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	}
 }
 
+bool
+FHoudiniEngineScheduler::InterruptCookingTask(const FGuid& InHapiGUID)
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	// HAPI_Interrupt affects the whole session, so make sure we're not interrupting another task's cook
+	if (!CookingTaskGUID.IsValid() || CookingTaskGUID != InHapiGUID)
+		return false;
+
+	if (bCookingTaskInterrupted)
+		return true;
+
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::Interrupt(FHoudiniEngine::Get().GetSession()))
+		return false;
+
+	bCookingTaskInterrupted = true;
+	return true;
+}
+
+bool
+FHoudiniEngineScheduler::FinishCookingTask()
+{
+	FScopeLock ScopeLock(&CriticalSection);
+
+	const bool bInterrupted = bCookingTaskInterrupted;
+	CookingTaskGUID.Invalidate();
+	bCookingTaskInterrupted = false;
+
+	return bInterrupted;
+}
+
 void
 FHoudiniEngineScheduler::TaskDeleteAsset(const FHoudiniEngineTask & Task)
 {
@@ -66,6 +66,10 @@ public:
 		const FHoudiniEngineTask & Task,
 		const FString & ErrorMessage);
 
+	// Interrupts the cook of a task, only if it is the task currently cooking.
+	// Returns true if the task's cook has been interrupted.
+	bool InterruptCookingTask(const FGuid& InHapiGUID);
+
 protected:
 
 	// Process queued tasks. 
@@ -89,6 +93,9 @@ protected:
 	// Process the result of a sucesfull cook
 	void TaskProccessAsset(const FHoudiniEngineTask & Task);
 
+	// Marks the current cook as finished, returns true if it has been interrupted
+	bool FinishCookingTask();
+
 private:
 
 	// Initial number of tasks in our circular queue. 
@@ -114,4 +121,8 @@ private:
 
 	// Stopping flag. 
 	bool bStopping;
+
+	// Task currently cooking, and whether its cook has been interrupted
+	FGuid CookingTaskGUID;
+	bool bCookingTaskInterrupted;
 };
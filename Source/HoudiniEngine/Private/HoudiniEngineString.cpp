@@ -182,4 +182,59 @@ FHoudiniEngineString::ToFText(const int32& InStringId, FText& OutText)
 {
 	FHoudiniEngineString HAPIString(InStringId);
 	return HAPIString.ToFText(OutText);
+}
+
+bool
+FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
+{
+	OutStringArray.Empty();
+	OutStringArray.SetNum(InStringIdArray.Num());
+
+	// Null / invalid string IDs are left empty
+	TArray<int32> ValidStringIds;
+	TArray<int32> ValidStringIndices;
+	for (int32 Idx = 0; Idx < InStringIdArray.Num(); Idx++)
+	{
+		if (InStringIdArray[Idx] <= 0)
+			continue;
+
+		ValidStringIds.Add(InStringIdArray[Idx]);
+		ValidStringIndices.Add(Idx);
+	}
+
+	if (ValidStringIds.Num() <= 0)
+		return true;
+
+	// Fetch all the strings at once, they are returned null-separated in the order of the handles
+	int32 BufferSize = 0;
+	if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetStringBatchSize(
+		FHoudiniEngine::Get().GetSession(), ValidStringIds.GetData(), ValidStringIds.Num(), &BufferSize)
+		&& BufferSize > 0)
+	{
+		TArray<char> Buffer;
+		Buffer.SetNumZeroed(BufferSize + 1);
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetStringBatch(
+			FHoudiniEngine::Get().GetSession(), Buffer.GetData(), BufferSize))
+		{
+			int32 Offset = 0;
+			for (int32 Idx = 0; Idx < ValidStringIndices.Num() && Offset < BufferSize; Idx++)
+			{
+				const char* CurrentString = Buffer.GetData() + Offset;
+				OutStringArray[ValidStringIndices[Idx]] = UTF8_TO_TCHAR(CurrentString);
+				Offset += FCStringAnsi::Strlen(CurrentString) + 1;
+			}
+
+			return true;
+		}
+	}
+
+	// Fall back to converting the strings one by one
+	bool bSuccess = true;
+	for (int32 Idx = 0; Idx < ValidStringIndices.Num(); Idx++)
+	{
+		if (!FHoudiniEngineString::ToFString(ValidStringIds[Idx], OutStringArray[ValidStringIndices[Idx]]))
+			bSuccess = false;
+	}
+
+	return bSuccess;
 }
\ No newline at end of file
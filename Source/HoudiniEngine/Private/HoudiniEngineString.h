@@ -57,6 +57,9 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		static bool ToFString(const int32& InStringId, FString & String);
 		static bool ToFText(const int32& InStringId, FText & Text);
 
+		// Converts an array of string handles, fetching all the strings in one batch when possible
+		static bool SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
+
 		// Return id of this string.
 		int32 GetId() const;
 
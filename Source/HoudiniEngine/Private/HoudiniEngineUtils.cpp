@@ -25,6 +25,7 @@
 */
 
 #include "HoudiniEngineUtils.h"
+#include "HoudiniParameterTranslator.h"
 #include "Misc/StringFormatArg.h"
 
 #if PLATFORM_WINDOWS
@@ -1218,18 +1219,53 @@ FHoudiniEngineUtils::LoadHoudiniAsset(UHoudiniAsset * HoudiniAsset, HAPI_AssetLi
 
 	// If the hda file exists, we can simply load it directly the file
 	HAPI_Result Result = HAPI_RESULT_FAILURE;
+	bool bLoadFromFile = false;
 	if ( !AssetFileName.IsEmpty() )
 	{
-		if ( FPaths::FileExists(AssetFileName)
-			|| (HoudiniAsset->IsExpandedHDA() && FPaths::DirectoryExists(AssetFileName) ) )
+		bLoadFromFile = FPaths::FileExists(AssetFileName)
+			|| (HoudiniAsset->IsExpandedHDA() && FPaths::DirectoryExists(AssetFileName));
+	}
+
+	// Libraries are only loaded once per session, unless their content has changed.
+	// Files are identified by their path, size and timestamp, memory copies by the hash of their content.
+	// Expanded hdas are always reloaded, as their content is spread over multiple files.
+	FString LibraryKey;
+	if (bLoadFromFile)
+	{
+		if (!HoudiniAsset->IsExpandedHDA())
 		{
-			// Load the asset from file.
-			std::string AssetFileNamePlain;
-			FHoudiniEngineUtils::ConvertUnrealString(AssetFileName, AssetFileNamePlain);
-			Result = FHoudiniApi::LoadAssetLibraryFromFile(
-				FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &OutAssetLibraryId);
+			IFileManager& FileManager = IFileManager::Get();
+			LibraryKey = FString::Printf(TEXT("File:%s:%lld:%lld"),
+				*AssetFileName, FileManager.FileSize(*AssetFileName), FileManager.GetTimeStamp(*AssetFileName).GetTicks());
 		}
 	}
+	else if (!HoudiniAsset->IsExpandedHDA() && HoudiniAsset->GetAssetBytesCount() > 0)
+	{
+		LibraryKey = FString::Printf(TEXT("Memory:%llu:%u"), HoudiniAsset->GetAssetBytesHash(), HoudiniAsset->GetAssetBytesCount());
+	}
+
+	if (!LibraryKey.IsEmpty() && FHoudiniEngine::Get().FindLoadedAssetLibrary(LibraryKey, OutAssetLibraryId))
+	{
+		// Make sure the library is still valid in the session before reusing it.
+		// If another library has overwritten some of its operator definitions since, it needs to be reloaded.
+		int32 AssetCount = 0;
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetAvailableAssetCount(FHoudiniEngine::Get().GetSession(), OutAssetLibraryId, &AssetCount)
+			&& AssetCount > 0
+			&& FHoudiniEngine::Get().AreAssetLibraryDefinitionsCurrent(OutAssetLibraryId))
+			return true;
+
+		FHoudiniEngine::Get().RemoveLoadedAssetLibrary(LibraryKey);
+		OutAssetLibraryId = -1;
+	}
+
+	if (bLoadFromFile)
+	{
+		// Load the asset from file.
+		std::string AssetFileNamePlain;
+		FHoudiniEngineUtils::ConvertUnrealString(AssetFileName, AssetFileNamePlain);
+		Result = FHoudiniApi::LoadAssetLibraryFromFile(
+			FHoudiniEngine::Get().GetSession(), AssetFileNamePlain.c_str(), true, &OutAssetLibraryId);
+	}
 
 	// Detect license issues
 	// HoudiniEngine aquires a license when creating/loading a node, not when creating a session
@@ -1259,6 +1295,9 @@ FHoudiniEngineUtils::LoadHoudiniAsset(UHoudiniAsset * HoudiniAsset, HAPI_AssetLi
 			// Warn the user that we are loading from memory
 			HOUDINI_LOG_WARNING(TEXT("Asset %s, loading from Memory: source asset file not found."), *AssetFileName);
 
+			// The library is now identified by the memory copy's content
+			LibraryKey = FString::Printf(TEXT("Memory:%llu:%u"), HoudiniAsset->GetAssetBytesHash(), HoudiniAsset->GetAssetBytesCount());
+
 			// Otherwise we will try to load from buffer we've cached.
 			Result = FHoudiniApi::LoadAssetLibraryFromMemory(
 				FHoudiniEngine::Get().GetSession(),
@@ -1273,6 +1312,19 @@ FHoudiniEngineUtils::LoadHoudiniAsset(UHoudiniAsset * HoudiniAsset, HAPI_AssetLi
 		return false;
 	}
 
+	if (!LibraryKey.IsEmpty())
+		FHoudiniEngine::Get().AddLoadedAssetLibrary(LibraryKey, OutAssetLibraryId);
+
+	// Keep track of the operators this library now defines, to detect when another library overwrites them
+	TArray<HAPI_StringHandle> AssetNameHandles;
+	TArray<FString> AssetNames;
+	if (FHoudiniEngineUtils::GetSubAssetNames(OutAssetLibraryId, AssetNameHandles))
+		FHoudiniEngineString::SHArrayToFStringArray(AssetNameHandles, AssetNames);
+	FHoudiniEngine::Get().SetAssetLibraryDefinitions(OutAssetLibraryId, AssetNames);
+
+	// The (re)loaded library may have changed the definitions of its assets, and their parameters' tags
+	FHoudiniParameterTranslator::ClearParameterTagsCache();
+
 	return true;
 }
 
@@ -4822,6 +4874,51 @@ FHoudiniEngineUtils::MoveActorToLevel(AActor* InActor, ULevel* InDesiredLevel)
 	return true;
 }
 
+// Objects resolved by LoadObjectFromPathCached, weak so the cache doesn't keep them loaded
+static TMap<FString, TWeakObjectPtr<UObject>> ResolvedObjectPathCache;
+
+UObject*
+FHoudiniEngineUtils::LoadObjectFromPathCached(const FString& InObjectPath, UClass* InClass, const bool& bFindClass)
+{
+	if (InObjectPath.IsEmpty())
+		return nullptr;
+
+	if (!InClass)
+		InClass = UObject::StaticClass();
+
+	check(IsInGameThread());
+
+	TWeakObjectPtr<UObject>* FoundObject = ResolvedObjectPathCache.Find(InObjectPath);
+	if (FoundObject && FoundObject->IsValid())
+	{
+		UObject* CachedObject = FoundObject->Get();
+		if (CachedObject->IsA(InClass) || (bFindClass && CachedObject->IsA<UClass>()))
+			return CachedObject;
+
+		return nullptr;
+	}
+
+	UObject* Object = StaticLoadObject(InClass, nullptr, *InObjectPath, nullptr, LOAD_NoWarn, nullptr);
+	if (!Object && bFindClass)
+	{
+		// See if the path is a class name instead
+		Object = FindObject<UClass>(ANY_PACKAGE, *InObjectPath);
+	}
+
+	if (!Object || Object->IsPendingKill())
+		return nullptr;
+
+	ResolvedObjectPathCache.Add(InObjectPath, Object);
+
+	return Object;
+}
+
+void
+FHoudiniEngineUtils::ClearResolvedObjectPathCache()
+{
+	ResolvedObjectPathCache.Empty();
+}
+
 bool
 FHoudiniEngineUtils::HapiCookNode(const HAPI_NodeId& InNodeId, HAPI_CookOptions* InCookOptions, const bool& bWaitForCompletion)
 {
@@ -34,6 +34,7 @@
 #include "HoudiniOutput.h"
 #include "HoudiniPackageParams.h"
 #include "Containers/UnrealString.h"
+#include "Async/ParallelFor.h"
 
 #include "SSCSEditor.h"
 
@@ -548,6 +549,14 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 
 		// Moves an actor to the specified level
 		static bool MoveActorToLevel(AActor* InActor, ULevel* InDesiredLevel);
+
+		// Loads the object at the given path, reusing the objects previously resolved during this session.
+		// Only successful loads are cached, the cache is cleared when assets are renamed or removed.
+		// If bFindClass is true, paths that can't be loaded are also looked up as class names.
+		static UObject* LoadObjectFromPathCached(const FString& InObjectPath, UClass* InClass, const bool& bFindClass = false);
+
+		// Empties the cache used by LoadObjectFromPathCached
+		static void ClearResolvedObjectPathCache();
 	
 		// -------------------------------------------------
 		// Debug Utilities
@@ -563,6 +572,44 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		static FString HapiGetEventTypeAsString(const HAPI_PDG_EventType& InEventType);
 		static FString HapiGetWorkitemStateAsString(const HAPI_PDG_WorkitemState& InWorkitemState);
 
+		// -------------------------------------------------
+		// Heightfield / Landscape data utilities
+		// -------------------------------------------------
+
+		// Transposes a 2D array while converting its values:
+		// OutData[X + Y * OutXSize] = Convert(InData[Y + X * OutYSize])
+		// Used to swap X/Y when converting between heightfield and landscape data.
+		// The data is processed in square blocks so both reads and writes stay in cache,
+		// and rows of blocks are converted in parallel.
+		template<typename TInType, typename TOutType, typename TConvertFunc>
+		static void TransposeAndConvertData(
+			const TInType* InData, TOutType* OutData,
+			const int32& OutXSize, const int32& OutYSize,
+			const TConvertFunc& Convert)
+		{
+			const int32 BlockSize = 64;
+			const int32 NumBlocksY = FMath::DivideAndRoundUp(OutYSize, BlockSize);
+
+			// Don't bother dispatching tasks for small arrays
+			const bool bSingleThread = (OutXSize * OutYSize) < (BlockSize * BlockSize * 4);
+
+			ParallelFor(NumBlocksY, [&](int32 BlockY)
+			{
+				const int32 Y0 = BlockY * BlockSize;
+				const int32 Y1 = FMath::Min(Y0 + BlockSize, OutYSize);
+				for (int32 X0 = 0; X0 < OutXSize; X0 += BlockSize)
+				{
+					const int32 X1 = FMath::Min(X0 + BlockSize, OutXSize);
+					for (int32 Y = Y0; Y < Y1; Y++)
+					{
+						TOutType* OutRow = OutData + Y * OutXSize;
+						for (int32 X = X0; X < X1; X++)
+							OutRow[X] = Convert(InData[Y + X * OutYSize]);
+					}
+				}
+			}, bSingleThread);
+		}
+
 		// -------------------------------------------------
 		// Generic naming / pathing utilities
 		// -------------------------------------------------
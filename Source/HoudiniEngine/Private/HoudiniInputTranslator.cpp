@@ -609,6 +609,11 @@ FHoudiniInputTranslator::UploadChangedInputs(UHoudiniAssetComponent * HAC)
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
+	// Inputs are uploaded one after the other on the game thread, before the cook is started.
+	// The input translators read their UObjects directly while marshalling them, and the HAPI session is shared
+	// with the cook thread, so inputs can't be uploaded by scheduler tasks or overlapped with each other
+	// without splitting every translator into a game thread snapshot and a threaded upload.
+	// Only the heightfield export overlaps its data conversion with its own uploads (see CreateHeightfieldFromLandscape).
 	//for (auto CurrentInput : HAC->Inputs)
 	for(int32 InputIdx = 0; InputIdx < HAC->GetNumInputs(); InputIdx++)
 	{
@@ -1366,7 +1371,42 @@ FHoudiniInputTranslator::UploadHoudiniInputTransform(
 
 		case EHoudiniInputObjectType::InstancedStaticMeshComponent:
 		{
-			// TODO: Only update the instances transform
+			UHoudiniInputInstancedMeshComponent* InISMC = Cast<UHoudiniInputInstancedMeshComponent>(InInputObject);
+			if (!InISMC || InISMC->IsPendingKill())
+			{
+				bSuccess = false;
+				break;
+			}
+
+			UInstancedStaticMeshComponent* ISMC = InISMC->GetInstancedStaticMeshComponent();
+			if (!ISMC || ISMC->IsPendingKill())
+			{
+				bSuccess = false;
+				break;
+			}
+
+			// Update using the instanced static mesh component's transform
+			if (!UpdateTransform(ISMC->GetComponentTransform(), InInputObject->InputObjectNodeId))
+			{
+				bSuccess = false;
+				break;
+			}
+
+			// Only send the instances that have been modified to the existing point cloud
+			if (InISMC->HasInstancesChanged())
+			{
+				if (!FUnrealInstanceTranslator::HapiUpdateInstancerTransforms(ISMC, InISMC->InputNodeId, InISMC->InstanceTransforms))
+				{
+					// We couldn't update the existing nodes, the whole instancer needs to be uploaded again
+					InISMC->MarkChanged(true);
+					bSuccess = false;
+					break;
+				}
+			}
+
+			// Update the cached instances
+			InISMC->Update(ISMC);
+
 			break;
 		}
 
@@ -2267,10 +2307,23 @@ FHoudiniInputTranslator::HapiCreateInputNodeForLandscape(
 	bool bSucess = false;
 	if (ExportType == EHoudiniLandscapeExportType::Heightfield)
 	{
-		bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName);
+		// Try to only send the modified components/layers to the previously created heightfield first
+		bSucess = FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObject->HeightfieldCache);
+		if (!bSucess)
+		{
+			// The heightfield needs to be recreated, delete the previous one if any
+			if (InObject->InputNodeId >= 0)
+				InObject->InvalidateData();
+
+			InObject->HeightfieldCache.Reset();
+			bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
+				Landscape, InObject->InputNodeId, InObjNodeName, &InObject->HeightfieldCache);
+		}
 	}
 	else
 	{
+		InObject->HeightfieldCache.Reset();
+
 		bool bExportLighting = InInput->bLandscapeExportLighting;
 		bool bExportMaterials = InInput->bLandscapeExportMaterials;
 		bool bExportNormalizedUVs = InInput->bLandscapeExportNormalizedUVs;
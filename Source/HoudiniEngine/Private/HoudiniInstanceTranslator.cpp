@@ -30,6 +30,7 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGenericAttribute.h"
+#include "HoudiniRuntimeSettings.h"
 #include "HoudiniInstancedActorComponent.h"
 #include "HoudiniMeshSplitInstancerComponent.h"
 #include "HoudiniStaticMeshComponent.h"
@@ -43,6 +44,9 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "InstancedFoliageActor.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Hash/CityHash.h"
 
 #if WITH_EDITOR
 	//#include "ScopedTransaction.h"
@@ -52,6 +56,27 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+static TAutoConsoleVariable<float> CVarHoudiniEngineInstancedActorSpawnBudget(
+	TEXT("HoudiniEngine.InstancedActorSpawnBudget"),
+	0.0f,
+	TEXT("Time budget (in ms) for spawning the actors of an actor instancer during a cook, remaining actors are spawned over the next ticks.\n")
+	TEXT("0: No budget, all actors are spawned during the cook\n")
+);
+
+// Instance actor waiting to be spawned by TickPendingInstanceActorSpawns
+struct FHoudiniPendingInstanceActorSpawn
+{
+	TWeakObjectPtr<UHoudiniInstancedActorComponent> InstancedActorComponent;
+	TWeakObjectPtr<UObject> InstancedObject;
+	TWeakObjectPtr<ULevel> SpawnLevel;
+	int32 InstanceIndex;
+	FTransform Transform;
+	TSharedPtr<const TArray<FHoudiniGenericAttribute>> PropertyAttributes;
+};
+
+static TArray<FHoudiniPendingInstanceActorSpawn> PendingInstanceActorSpawns;
+static FDelegateHandle PendingInstanceActorSpawnsTickerHandle;
+
 // Fastrand is a faster alternative to std::rand()
 // and doesn't oscillate when looking for 2 values like Unreal's.
 inline int fastrand(int& nSeed)
@@ -70,6 +95,9 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 	// Get if force to use HISM from attribute
 	OutInstancedOutputPartData.bForceHISM = HasHISMAttribute(InHGPO.GeoId, InHGPO.PartId);
 
+	// Get the size of the cells used to split the instances
+	OutInstancedOutputPartData.InstancerCellSize = GetInstancerCellSize(InHGPO.GeoId, InHGPO.PartId);
+
 	// Extract the object and transforms for this instancer
 	if (!GetInstancerObjectsAndTransforms(
 			InHGPO,
@@ -243,6 +271,15 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 			VariationInstancedObjects, VariationInstancedTransforms, 
 			VariationOriginalObjectIndices, VariationIndices);
 
+		// Large ISMC / HISMC instancers can be split in cells, each cell creating its own component
+		TArray<int32> VariationSourceIndices;
+		TArray<FString> VariationCellSuffixes;
+		SplitInstanceVariationsInCells(
+			(InstancedOutputPartData.bIsFoliageInstancer || InstancedOutputPartData.bSplitMeshInstancer) ? 0.0f : InstancedOutputPartData.InstancerCellSize,
+			VariationInstancedObjects, VariationInstancedTransforms,
+			VariationOriginalObjectIndices, VariationIndices,
+			VariationSourceIndices, VariationCellSuffixes);
+
 		// Create the instancer components now
 		for (int32 InstanceObjectIdx = 0; InstanceObjectIdx < VariationInstancedObjects.Num(); InstanceObjectIdx++)
 		{
@@ -268,10 +305,12 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 
 			// Update the split identifier for this object
 			// We use both the original object index and the variation index: ORIG_VAR
+			// Instancers split in cells add the cell to it: ORIG_VAR_cellX_Y
 			OutputIdentifier.SplitIdentifier = 
 				FString::FromInt(VariationOriginalObjectIndices[InstanceObjectIdx])
 				+ TEXT("_")
-				+ FString::FromInt(VariationIndices[InstanceObjectIdx]);
+				+ FString::FromInt(VariationIndices[InstanceObjectIdx])
+				+ VariationCellSuffixes[InstanceObjectIdx];
 				
 			// Get the OutputObj for this variation
 			FHoudiniOutputObject* FoundOutputObject = OldOutputObjects.Find(OutputIdentifier);
@@ -292,7 +331,7 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 
 			// Extract the material for this variation
 			TArray<UMaterialInterface*> VariationMaterials;
-			if (!GetVariationMaterials(FoundInstancedOutput, InstanceObjectIdx, InstancerMaterials, VariationMaterials))
+			if (!GetVariationMaterials(FoundInstancedOutput, VariationSourceIndices[InstanceObjectIdx], InstancerMaterials, VariationMaterials))
 				VariationMaterials.Empty();
 
 			USceneComponent* NewInstancerComponent = nullptr;
@@ -485,6 +524,9 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 	// Get if force using HISM from attribute
 	bool bForceHISM = HasHISMAttribute(InOutputIdentifier.GeoId, InOutputIdentifier.PartId);
 
+	// Get the size of the cells used to split the instances
+	const float InstancerCellSize = GetInstancerCellSize(InOutputIdentifier.GeoId, InOutputIdentifier.PartId);
+
 	TArray<UObject*> OriginalInstancedObjects;
 	OriginalInstancedObjects.Add(InInstancedOutput.OriginalObject.LoadSynchronous());
 
@@ -536,6 +578,15 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 	if (!GetInstancerMaterials(OutputIdentifier.GeoId, OutputIdentifier.PartId, InstancerMaterials))
 		InstancerMaterials.Empty();
 
+	// Large ISMC / HISMC instancers can be split in cells, each cell creating its own component
+	TArray<int32> VariationSourceIndices;
+	TArray<FString> VariationCellSuffixes;
+	SplitInstanceVariationsInCells(
+		(bIsFoliageInstancer || bSplitMeshInstancer) ? 0.0f : InstancerCellSize,
+		InstancedObjects, InstancedTransforms,
+		VariationOriginalObjectIndices, VariationIndices,
+		VariationSourceIndices, VariationCellSuffixes);
+
 	// Keep track of the new instancer component in order to be able to clean up the unused/stale ones after.
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutputObjects = InParentOutput->GetOutputObjects();
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject> ToDeleteOutputObjects = InParentOutput->GetOutputObjects();
@@ -557,10 +608,12 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 		// Update the split identifier for this object
 		// We use both the original object index and the variation index: ORIG_VAR
 		// the original object index is used for the instanced outputs split identifier
+		// Instancers split in cells add the cell to it: ORIG_VAR_cellX_Y
 		OutputIdentifier.SplitIdentifier =
 			InOutputIdentifier.SplitIdentifier
 			+ TEXT("_")
-			+ FString::FromInt(VariationIndices[InstanceObjectIdx]);
+			+ FString::FromInt(VariationIndices[InstanceObjectIdx])
+			+ VariationCellSuffixes[InstanceObjectIdx];
 
 		// See if we can find an preexisting component for this obj	to try to reuse it
 		USceneComponent* OldInstancerComponent = nullptr;
@@ -573,7 +626,7 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 		// Extract the material for this variation
 //		FHoudiniInstancedOutput* FoundInstancedOutput = InstancedOutputs.Find(OutputIdentifier);
 		TArray<UMaterialInterface*> VariationMaterials;
-		if (!GetVariationMaterials(&InInstancedOutput, InstanceObjectIdx, InstancerMaterials, VariationMaterials))
+		if (!GetVariationMaterials(&InInstancedOutput, VariationSourceIndices[InstanceObjectIdx], InstancerMaterials, VariationMaterials))
 			VariationMaterials.Empty();
 
 		USceneComponent* NewInstancerComponent = nullptr;
@@ -1258,20 +1311,10 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 			return false;
 		}
 
-		// Attempt to load specified asset.
+		// Attempt to load specified asset, or see if the ref is a class that we can instantiate
+		// TODO: ensure we'll be able to create an actor from this class! 
 		const FString & AssetName = DetailInstanceValues[0];
-		UObject * AttributeObject = StaticLoadObject(UObject::StaticClass(), nullptr, *AssetName, nullptr, LOAD_None, nullptr);
-
-		if (!AttributeObject)
-		{
-			// See if the ref is a class that we can instantiate
-			UClass * FoundClass = FindObject<UClass>(ANY_PACKAGE, *AssetName);
-			if (FoundClass != nullptr)
-			{
-				// TODO: ensure we'll be able to create an actor from this class! 
-				AttributeObject = FoundClass;
-			}
-		}
+		UObject * AttributeObject = FHoudiniEngineUtils::LoadObjectFromPathCached(AssetName, UObject::StaticClass(), true);
 
 		if (!AttributeObject && bDefaultObjectEnabled)
 		{
@@ -1321,43 +1364,47 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 		}
 
 		// If instance attribute exists on points, we need to get all the unique values.
-		// This will give us all the unique object we want to instance
-		TMap<FString, UObject *> ObjectsToInstance;
-		for (const auto& Iter : PointInstanceValues)
-		{
-			if (!ObjectsToInstance.Contains(Iter))
+		// This will give us all the unique object we want to instance.
+		// Each point then refers to its value by index so we don't compare strings per point.
+		TMap<FString, int32> UniqueValueIndices;
+		TArray<int32> PointValueIndices;
+		PointValueIndices.SetNumUninitialized(PointInstanceValues.Num());
+		TArray<const FString*> UniqueValues;
+		for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
+		{
+			const FString& CurrentValue = PointInstanceValues[Idx];
+			int32* FoundIndex = UniqueValueIndices.Find(CurrentValue);
+			if (!FoundIndex)
 			{
-				// To avoid trying to load an object that fails multiple times,
-				// still add it to the array if null so we can still skip further attempts
-				UObject * AttributeObject = StaticLoadObject(
-					UObject::StaticClass(), nullptr, *Iter, nullptr, LOAD_None, nullptr);
-
-				if (!AttributeObject)
-				{
-					// See if the ref is a class that we can instantiate
-					UClass * FoundClass = FindObject<UClass>(ANY_PACKAGE, *Iter);
-					if (FoundClass != nullptr)
-					{
-						// TODO: ensure we'll be able to create an actor from this class!
-						AttributeObject = FoundClass;
-					}
-				}
-
-				ObjectsToInstance.Add(Iter, AttributeObject);
+				FoundIndex = &UniqueValueIndices.Add(CurrentValue, UniqueValues.Num());
+				UniqueValues.Add(&CurrentValue);
 			}
+
+			PointValueIndices[Idx] = *FoundIndex;
 		}
 
+		// Bucket the points per unique value
+		TArray<TArray<int32>> UniqueValuePoints;
+		UniqueValuePoints.SetNum(UniqueValues.Num());
+		for (int32 Idx = 0; Idx < PointValueIndices.Num(); ++Idx)
+			UniqueValuePoints[PointValueIndices[Idx]].Add(Idx);
+
 		// Iterates through all the unique objects and get their corresponding transforms
 		bool Success = false;
-		for (auto Iter : ObjectsToInstance)
+		for (int32 ValueIdx = 0; ValueIdx < UniqueValues.Num(); ValueIdx++)
 		{
+			const FString & InstancePath = *UniqueValues[ValueIdx];
+
+			// Try to load this object, or see if the ref is a class that we can instantiate
+			// TODO: ensure we'll be able to create an actor from this class!
+			UObject * AttributeObject = FHoudiniEngineUtils::LoadObjectFromPathCached(InstancePath, UObject::StaticClass(), true);
+
 			bool bHiddenInGame = false;
 			// Check that we managed to load this object
-			UObject * AttributeObject = Iter.Value;
 			if (!AttributeObject && bDefaultObjectEnabled) 
 			{
 				HOUDINI_LOG_WARNING(
-					TEXT("Failed to load instanced object '%s', use default mesh (hidden in game)."), *(Iter.Key));
+					TEXT("Failed to load instanced object '%s', use default mesh (hidden in game)."), *InstancePath);
 
 				// If failed to load this object, add default reference mesh
 				UStaticMesh * DefaultReferenceSM = FHoudiniEngine::Get().GetHoudiniDefaultReferenceMesh().Get();
@@ -1376,44 +1423,27 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 			if (!AttributeObject)
 				continue;
 
-			if (!bHasSplitAttribute)
-			{
-				// No Split attribute:
-				// Extract the transform values that correspond to this object, and add them to the output arrays
-				const FString & InstancePath = Iter.Key;
-				TArray<FTransform> ObjectTransforms;
-				for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
-				{
-					if (InstancePath.Equals(PointInstanceValues[Idx]))
-						ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
-				}
+			// Extract the transform values that correspond to this object, and add them to the output arrays
+			// If we have a split attribute, extract the split attribute values as well, we will process the splits after
+			const TArray<int32>& ObjectPoints = UniqueValuePoints[ValueIdx];
+			TArray<FTransform> ObjectTransforms;
+			ObjectTransforms.Reserve(ObjectPoints.Num());
+			for (const int32& Idx : ObjectPoints)
+				ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
 
-				OutInstancedObjects.Add(AttributeObject);
-				OutInstancedTransforms.Add(ObjectTransforms);
-				Success = true;
-			}
-			else
+			if (bHasSplitAttribute)
 			{
-				// We have a split attribute:
-				// Extract the transform values and split attribute values for this object,
-				// add them to the output arrays, and we will process the splits after
-				const FString & InstancePath = Iter.Key;
-				TArray<FTransform> ObjectTransforms;
 				TArray<FString> ObjectSplitValues;
-				for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
-				{
-					if (InstancePath.Equals(PointInstanceValues[Idx]))
-					{
-						ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
-						ObjectSplitValues.Add(AllSplitAttributeValues[Idx]);
-					}
-				}
+				ObjectSplitValues.Reserve(ObjectPoints.Num());
+				for (const int32& Idx : ObjectPoints)
+					ObjectSplitValues.Add(AllSplitAttributeValues[Idx]);
 
-				OutInstancedObjects.Add(AttributeObject);
-				OutInstancedTransforms.Add(ObjectTransforms);
 				SplitAttributeValuesPerObject.Add(ObjectSplitValues);
-				Success = true;
 			}
+
+			OutInstancedObjects.Add(AttributeObject);
+			OutInstancedTransforms.Add(ObjectTransforms);
+			Success = true;
 		}
 
 		if (!Success) 
@@ -1864,13 +1894,7 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	}
 
 	// Now add the instances themselves
-	// TODO: We should be calling  UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances( ... )
-	InstancedStaticMeshComponent->ClearInstances();
-	InstancedStaticMeshComponent->PreAllocateInstancesMemory(InstancedObjectTransforms.Num());
-	for (const auto& Transform : InstancedObjectTransforms)
-	{
-		InstancedStaticMeshComponent->AddInstance(Transform);
-	}
+	UpdateInstancedStaticMeshComponentInstances(InstancedStaticMeshComponent, InstancedObjectTransforms);
 
 	// Apply generic attributes if we have any
 	// TODO: Handle variations w/ index
@@ -1890,6 +1914,223 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	return true;
 }
 
+void
+FHoudiniInstanceTranslator::SplitInstanceVariationsInCells(
+	const float& InCellSize,
+	TArray<TSoftObjectPtr<UObject>>& InOutVariationObjects,
+	TArray<TArray<FTransform>>& InOutVariationTransforms,
+	TArray<int32>& InOutVariationOriginalObjectIndices,
+	TArray<int32>& InOutVariationIndices,
+	TArray<int32>& OutVariationSourceIndices,
+	TArray<FString>& OutVariationCellSuffixes)
+{
+	OutVariationSourceIndices.Empty();
+	OutVariationCellSuffixes.Empty();
+
+	TArray<TSoftObjectPtr<UObject>> SplitObjects;
+	TArray<TArray<FTransform>> SplitTransforms;
+	TArray<int32> SplitOriginalObjectIndices;
+	TArray<int32> SplitVariationIndices;
+	for (int32 VariationIdx = 0; VariationIdx < InOutVariationObjects.Num(); VariationIdx++)
+	{
+		if (!InOutVariationTransforms.IsValidIndex(VariationIdx))
+			break;
+
+		// Only static meshes instancers (ISMC / HISMC) are split
+		TArray<FIntPoint> Cells;
+		TArray<TArray<FTransform>> CellTransforms;
+		UObject* VariationObject = InOutVariationObjects[VariationIdx].LoadSynchronous();
+		if (!VariationObject
+			|| !VariationObject->IsA<UStaticMesh>()
+			|| !SplitInstanceTransformsInCells(InOutVariationTransforms[VariationIdx], InCellSize, Cells, CellTransforms))
+		{
+			Cells.Empty();
+			CellTransforms.Empty();
+			CellTransforms.Add(MoveTemp(InOutVariationTransforms[VariationIdx]));
+		}
+
+		for (int32 CellIdx = 0; CellIdx < CellTransforms.Num(); CellIdx++)
+		{
+			SplitObjects.Add(InOutVariationObjects[VariationIdx]);
+			SplitTransforms.Add(MoveTemp(CellTransforms[CellIdx]));
+			SplitOriginalObjectIndices.Add(InOutVariationOriginalObjectIndices[VariationIdx]);
+			SplitVariationIndices.Add(InOutVariationIndices[VariationIdx]);
+			OutVariationSourceIndices.Add(VariationIdx);
+			OutVariationCellSuffixes.Add(Cells.IsValidIndex(CellIdx)
+				? FString::Printf(TEXT("_cell%d_%d"), Cells[CellIdx].X, Cells[CellIdx].Y)
+				: FString());
+		}
+	}
+
+	InOutVariationObjects = MoveTemp(SplitObjects);
+	InOutVariationTransforms = MoveTemp(SplitTransforms);
+	InOutVariationOriginalObjectIndices = MoveTemp(SplitOriginalObjectIndices);
+	InOutVariationIndices = MoveTemp(SplitVariationIndices);
+}
+
+bool
+FHoudiniInstanceTranslator::SplitInstanceTransformsInCells(
+	const TArray<FTransform>& InTransforms,
+	const float& InCellSize,
+	TArray<FIntPoint>& OutCells,
+	TArray<TArray<FTransform>>& OutCellTransforms)
+{
+	OutCells.Empty();
+	OutCellTransforms.Empty();
+
+	if (InCellSize <= 0.0f || InTransforms.Num() <= 1)
+		return false;
+
+	// Find the cell of each instance
+	TArray<FIntPoint> InstanceCells;
+	InstanceCells.SetNumUninitialized(InTransforms.Num());
+	ParallelFor(InTransforms.Num(), [&](int32 Idx)
+	{
+		const FVector Location = InTransforms[Idx].GetLocation();
+		InstanceCells[Idx] = FIntPoint(
+			FMath::FloorToInt(Location.X / InCellSize),
+			FMath::FloorToInt(Location.Y / InCellSize));
+	});
+
+	// Sort the cells so their order doesn't depend on the instances' order
+	TMap<FIntPoint, int32> CellIndices;
+	for (const FIntPoint& Cell : InstanceCells)
+		CellIndices.FindOrAdd(Cell)++;
+
+	if (CellIndices.Num() <= 1)
+		return false;
+
+	CellIndices.KeySort([](const FIntPoint& A, const FIntPoint& B)
+	{
+		return A.Y != B.Y ? A.Y < B.Y : A.X < B.X;
+	});
+
+	OutCells.Reserve(CellIndices.Num());
+	OutCellTransforms.SetNum(CellIndices.Num());
+	for (auto& CurrentCell : CellIndices)
+	{
+		const int32 CellIdx = OutCells.Num();
+		OutCellTransforms[CellIdx].Reserve(CurrentCell.Value);
+		OutCells.Add(CurrentCell.Key);
+		CurrentCell.Value = CellIdx;
+	}
+
+	for (int32 Idx = 0; Idx < InTransforms.Num(); Idx++)
+		OutCellTransforms[CellIndices[InstanceCells[Idx]]].Add(InTransforms[Idx]);
+
+	return true;
+}
+
+FString
+FHoudiniInstanceTranslator::GetVariationSplitIdentifier(const FString& InSplitIdentifier)
+{
+	// Remove the cell suffix added when splitting instancers in cells
+	const int32 CellSuffixIdx = InSplitIdentifier.Find(TEXT("_cell"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+	return CellSuffixIdx != INDEX_NONE ? InSplitIdentifier.Left(CellSuffixIdx) : InSplitIdentifier;
+}
+
+float
+FHoudiniInstanceTranslator::GetInstancerCellSize(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId)
+{
+	float CellSize = 0.0f;
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	if (HoudiniRuntimeSettings)
+		CellSize = HoudiniRuntimeSettings->MarshallingInstancerCellSize;
+
+	// The attribute overrides the runtime settings, and is in Houdini units
+	HAPI_AttributeInfo AttriInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttriInfo);
+	TArray<float> FloatData;
+	if (FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(GeoId, PartId,
+		HAPI_UNREAL_ATTRIB_INSTANCER_CELL_SIZE, AttriInfo, FloatData, 1))
+	{
+		if (FloatData.Num() > 0)
+			CellSize = FloatData[0] * HAPI_UNREAL_SCALE_FACTOR_POSITION;
+	}
+
+	return CellSize;
+}
+
+void
+FHoudiniInstanceTranslator::UpdateInstancedStaticMeshComponentInstances(
+	UInstancedStaticMeshComponent* InISMC,
+	const TArray<FTransform>& InstancedObjectTransforms)
+{
+	if (!InISMC || InISMC->IsPendingKill())
+		return;
+
+	const int32 NumOldInstances = InISMC->GetInstanceCount();
+	const int32 NumNewInstances = InstancedObjectTransforms.Num();
+	const int32 NumCommonInstances = FMath::Min(NumOldInstances, NumNewInstances);
+
+	// Find the instances whose transform has changed
+	TArray<uint8> InstanceChanged;
+	InstanceChanged.SetNumZeroed(NumCommonInstances);
+	ParallelFor(NumCommonInstances, [&](int32 Idx)
+	{
+		const FMatrix NewMatrix = InstancedObjectTransforms[Idx].ToMatrixWithScale();
+		if (!InISMC->PerInstanceSMData[Idx].Transform.Equals(NewMatrix))
+			InstanceChanged[Idx] = 1;
+	});
+
+	int32 NumChangedInstances = FMath::Abs(NumNewInstances - NumOldInstances);
+	for (const uint8& bChanged : InstanceChanged)
+		NumChangedInstances += bChanged;
+
+	if (NumChangedInstances == 0)
+		return;
+
+	// If most instances have changed, it's faster to add them all at once.
+	// This also rebuilds the HISMC's cluster tree only once.
+	if (NumChangedInstances * 2 > NumNewInstances)
+	{
+		InISMC->ClearInstances();
+		InISMC->PreAllocateInstancesMemory(NumNewInstances);
+		InISMC->AddInstances(InstancedObjectTransforms, false);
+		return;
+	}
+
+	// Update each run of consecutive modified instances
+	TArray<FTransform> RunTransforms;
+	int32 Idx = 0;
+	while (Idx < NumCommonInstances)
+	{
+		if (!InstanceChanged[Idx])
+		{
+			Idx++;
+			continue;
+		}
+
+		const int32 RunStart = Idx;
+		while (Idx < NumCommonInstances && InstanceChanged[Idx])
+			Idx++;
+
+		RunTransforms.Reset(Idx - RunStart);
+		RunTransforms.Append(InstancedObjectTransforms.GetData() + RunStart, Idx - RunStart);
+		InISMC->BatchUpdateInstancesTransforms(RunStart, RunTransforms, false, false, false);
+	}
+
+	if (NumNewInstances > NumOldInstances)
+	{
+		// Add the new instances
+		RunTransforms.Reset(NumNewInstances - NumOldInstances);
+		RunTransforms.Append(InstancedObjectTransforms.GetData() + NumOldInstances, NumNewInstances - NumOldInstances);
+		InISMC->AddInstances(RunTransforms, false);
+	}
+	else if (NumNewInstances < NumOldInstances)
+	{
+		// Remove the extra instances, starting from the end
+		TArray<int32> InstancesToRemove;
+		InstancesToRemove.Reserve(NumOldInstances - NumNewInstances);
+		for (int32 RemoveIdx = NumOldInstances - 1; RemoveIdx >= NumNewInstances; RemoveIdx--)
+			InstancesToRemove.Add(RemoveIdx);
+
+		InISMC->RemoveInstances(InstancesToRemove);
+	}
+
+	InISMC->MarkRenderStateDirty();
+}
+
 bool
 FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	UObject* InstancedObject,
@@ -1941,6 +2182,16 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	if (!SpawnLevel)
 		return false;
 
+	// Forget the actors a previous cook of this component had left to spawn
+	PendingInstanceActorSpawns.RemoveAll([InstancedActorComponent](const FHoudiniPendingInstanceActorSpawn& Pending)
+	{
+		return Pending.InstancedActorComponent.Get() == InstancedActorComponent;
+	});
+
+	const double SpawnBudget = CVarHoudiniEngineInstancedActorSpawnBudget.GetValueOnAnyThread() / 1000.0;
+	const double SpawnStartTime = FPlatformTime::Seconds();
+	TSharedPtr<const TArray<FHoudiniGenericAttribute>> SharedPropertyAttributes;
+
 	// Set the number of needed instances
 	InstancedActorComponent->SetNumberOfInstances(InstancedObjectTransforms.Num());
 	for (int32 Idx = 0; Idx < InstancedObjectTransforms.Num(); Idx++)
@@ -1949,11 +2200,31 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		const FTransform& CurTransform = InstancedObjectTransforms[Idx];
 
 		// Get the current instance
-		// If null, we need to create a new one, else we can reuse the actor
+		// If null, try to reuse a pooled actor or create a new one, else we can reuse the actor
 		AActor* CurInstance = InstancedActorComponent->GetInstancedActorAt(Idx);
 		if (!CurInstance || CurInstance->IsPendingKill())
 		{
-			CurInstance = SpawnInstanceActor(CurTransform, SpawnLevel, InstancedActorComponent);
+			CurInstance = InstancedActorComponent->AcquirePooledActor();
+			if (!CurInstance)
+			{
+				if (SpawnBudget > 0.0 && (FPlatformTime::Seconds() - SpawnStartTime) > SpawnBudget)
+				{
+					// We're out of time, spawn this actor on a later tick
+					if (!SharedPropertyAttributes.IsValid())
+						SharedPropertyAttributes = MakeShared<TArray<FHoudiniGenericAttribute>>(AllPropertyAttributes);
+
+					FHoudiniPendingInstanceActorSpawn& Pending = PendingInstanceActorSpawns.AddDefaulted_GetRef();
+					Pending.InstancedActorComponent = InstancedActorComponent;
+					Pending.InstancedObject = InstancedObject;
+					Pending.SpawnLevel = SpawnLevel;
+					Pending.InstanceIndex = Idx;
+					Pending.Transform = CurTransform;
+					Pending.PropertyAttributes = SharedPropertyAttributes;
+					continue;
+				}
+
+				CurInstance = SpawnInstanceActor(CurTransform, SpawnLevel, InstancedActorComponent);
+			}
 			InstancedActorComponent->SetInstanceAt(Idx, CurTransform, CurInstance);
 		}
 		else
@@ -1967,6 +2238,12 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		UpdateGenericPropertiesAttributes(CurInstance, AllPropertyAttributes, Idx);
 	}
 
+	if (PendingInstanceActorSpawns.Num() > 0 && !PendingInstanceActorSpawnsTickerHandle.IsValid())
+	{
+		PendingInstanceActorSpawnsTickerHandle = FTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateStatic(&FHoudiniInstanceTranslator::TickPendingInstanceActorSpawns));
+	}
+
 	// Assign the new ISMC / HISMC to the output component if we created a new one
 	if (bCreatedNewComponent)
 	{
@@ -1976,6 +2253,123 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	return true;
 }
 
+// Spawns a pending instance actor, if its component still needs it
+static bool
+SpawnPendingInstanceActor(const FHoudiniPendingInstanceActorSpawn& InPending)
+{
+	UHoudiniInstancedActorComponent* IAC = InPending.InstancedActorComponent.Get();
+	if (!IAC || IAC->IsPendingKill())
+		return false;
+
+	// Make sure the instance still needs that actor
+	if (!InPending.InstancedObject.IsValid() || InPending.InstancedObject.Get() != IAC->GetInstancedObject())
+		return false;
+
+	if (!IAC->GetInstancedActors().IsValidIndex(InPending.InstanceIndex))
+		return false;
+
+	AActor* CurInstance = IAC->GetInstancedActorAt(InPending.InstanceIndex);
+	if (CurInstance && !CurInstance->IsPendingKill())
+		return false;
+
+	ULevel* SpawnLevel = InPending.SpawnLevel.Get();
+	if (!SpawnLevel)
+		return false;
+
+	CurInstance = FHoudiniInstanceTranslator::SpawnInstanceActor(InPending.Transform, SpawnLevel, IAC);
+	if (!IAC->SetInstanceAt(InPending.InstanceIndex, InPending.Transform, CurInstance))
+		return false;
+
+	if (InPending.PropertyAttributes.IsValid())
+		FHoudiniInstanceTranslator::UpdateGenericPropertiesAttributes(CurInstance, *InPending.PropertyAttributes, InPending.InstanceIndex);
+
+	return true;
+}
+
+bool
+FHoudiniInstanceTranslator::TickPendingInstanceActorSpawns(float DeltaTime)
+{
+	const double SpawnBudget = CVarHoudiniEngineInstancedActorSpawnBudget.GetValueOnAnyThread() / 1000.0;
+	const double SpawnStartTime = FPlatformTime::Seconds();
+
+	int32 NumProcessed = 0;
+	for (; NumProcessed < PendingInstanceActorSpawns.Num(); NumProcessed++)
+	{
+		// Always spawn at least one actor per tick
+		if (NumProcessed > 0 && SpawnBudget > 0.0 && (FPlatformTime::Seconds() - SpawnStartTime) > SpawnBudget)
+			break;
+
+		SpawnPendingInstanceActor(PendingInstanceActorSpawns[NumProcessed]);
+	}
+
+	PendingInstanceActorSpawns.RemoveAt(0, NumProcessed);
+	if (PendingInstanceActorSpawns.Num() > 0)
+		return true;
+
+	// Nothing left to spawn, remove the ticker
+	PendingInstanceActorSpawnsTickerHandle.Reset();
+	return false;
+}
+
+void
+FHoudiniInstanceTranslator::FlushPendingInstanceActorSpawns(UHoudiniInstancedActorComponent* InIAC)
+{
+	// Spawn the pending actors now, ignoring the budget
+	for (int32 Idx = 0; Idx < PendingInstanceActorSpawns.Num(); Idx++)
+	{
+		if (InIAC && PendingInstanceActorSpawns[Idx].InstancedActorComponent.Get() != InIAC)
+			continue;
+
+		const FHoudiniPendingInstanceActorSpawn Pending = PendingInstanceActorSpawns[Idx];
+		PendingInstanceActorSpawns.RemoveAt(Idx--);
+		SpawnPendingInstanceActor(Pending);
+	}
+
+	if (PendingInstanceActorSpawns.Num() <= 0)
+		ClearPendingInstanceActorSpawns();
+}
+
+void
+FHoudiniInstanceTranslator::ClearPendingInstanceActorSpawns()
+{
+	PendingInstanceActorSpawns.Empty();
+
+	if (PendingInstanceActorSpawnsTickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(PendingInstanceActorSpawnsTickerHandle);
+		PendingInstanceActorSpawnsTickerHandle.Reset();
+	}
+}
+
+// Hash the generic property attribute values of an instance, instances with different values can't share a component
+static uint64
+GetInstancePropertyAttributesHash(const TArray<FHoudiniGenericAttribute>& InPropertyAttributes, const int32& InInstanceIndex)
+{
+	uint64 Hash = 0;
+	for (const FHoudiniGenericAttribute& CurrentAttribute : InPropertyAttributes)
+	{
+		// Detail attributes have the same value for all instances
+		if (CurrentAttribute.AttributeOwner == EAttribOwner::Detail)
+			continue;
+
+		for (int32 TupleIdx = 0; TupleIdx < CurrentAttribute.AttributeTupleSize; TupleIdx++)
+		{
+			const int32 ValueIdx = InInstanceIndex * CurrentAttribute.AttributeTupleSize + TupleIdx;
+			if (CurrentAttribute.DoubleValues.IsValidIndex(ValueIdx))
+				Hash = CityHash64WithSeed((const char*)&CurrentAttribute.DoubleValues[ValueIdx], sizeof(double), Hash);
+			if (CurrentAttribute.IntValues.IsValidIndex(ValueIdx))
+				Hash = CityHash64WithSeed((const char*)&CurrentAttribute.IntValues[ValueIdx], sizeof(int64), Hash);
+			if (CurrentAttribute.StringValues.IsValidIndex(ValueIdx))
+			{
+				const FString& StringValue = CurrentAttribute.StringValues[ValueIdx];
+				Hash = CityHash64WithSeed((const char*)*StringValue, StringValue.Len() * sizeof(TCHAR), Hash);
+			}
+		}
+	}
+
+	return Hash;
+}
+
 // Create or update a MSIC
 bool 
 FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
@@ -2017,9 +2411,6 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 	MeshSplitComponent->SetStaticMesh(InstancedStaticMesh);
 	MeshSplitComponent->SetOverrideMaterials(InInstancerMaterials);
 
-	// Now add the instances
-	MeshSplitComponent->SetInstanceTransforms(InstancedObjectTransforms);
-
 	// Check for instance colors
 	TArray<FLinearColor> InstanceColorOverrides;
 	bool ColorOverrideAttributeFound = false;
@@ -2089,26 +2480,80 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 		}
 	}
 
-	// if we have vertex color overrides, apply them now
-#if WITH_EDITOR
-	if (InstanceColorOverrides.Num() > 0)
+	// Convert the color attribute to FColor
+	TArray<FColor> InstanceColors;
+	InstanceColors.SetNumUninitialized(InstanceColorOverrides.Num());
+	for (int32 ix = 0; ix < InstanceColors.Num(); ++ix)
+	{
+		InstanceColors[ix] = InstanceColorOverrides[ix].GetClamped().ToFColor(false);
+	}
+
+	// Index of the instance used for each of the split component's components
+	TArray<int32> ComponentInstanceIndices;
+
+	bool bGroupInstances = false;
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	if (HoudiniRuntimeSettings)
+		bGroupInstances = HoudiniRuntimeSettings->MarshallingGroupSplitInstances;
+
+	// Instanced static mesh components ignore the components' override vertex colors,
+	// so instancers with color overrides keep one static mesh component per instance
+	if (InstanceColors.Num() > 0)
+		bGroupInstances = false;
+
+	if (bGroupInstances)
 	{
-		// Convert the color attribute to FColor
-		TArray<FColor> InstanceColors;
-		InstanceColors.SetNumUninitialized(InstanceColorOverrides.Num());
-		for (int32 ix = 0; ix < InstanceColors.Num(); ++ix)
+		// Group the instances sharing the same material and property attribute values, each group will use a single ISMC
+		TMap<TPair<UMaterialInterface*, uint64>, int32> GroupIndices;
+		TArray<int32> InstanceGroups;
+		InstanceGroups.SetNumUninitialized(InstancedObjectTransforms.Num());
+		for (int32 InstIndex = 0; InstIndex < InstancedObjectTransforms.Num(); InstIndex++)
 		{
-			InstanceColors[ix] = InstanceColorOverrides[ix].GetClamped().ToFColor(false);
+			UMaterialInterface* InstanceMaterial = nullptr;
+			if (InInstancerMaterials.Num() > 0)
+				InstanceMaterial = InInstancerMaterials.IsValidIndex(InstIndex) ? InInstancerMaterials[InstIndex] : InInstancerMaterials[0];
+
+			const uint64 PropertiesHash = GetInstancePropertyAttributesHash(AllPropertyAttributes, InstIndex);
+
+			const TPair<UMaterialInterface*, uint64> GroupKey(InstanceMaterial, PropertiesHash);
+			int32* FoundGroup = GroupIndices.Find(GroupKey);
+			if (!FoundGroup)
+			{
+				FoundGroup = &GroupIndices.Add(GroupKey, ComponentInstanceIndices.Num());
+				ComponentInstanceIndices.Add(InstIndex);
+			}
+
+			InstanceGroups[InstIndex] = *FoundGroup;
 		}
 
+		MeshSplitComponent->SetGroupedInstanceTransforms(InstancedObjectTransforms, InstanceGroups);
+	}
+	else
+	{
+		// Now add the instances
+		MeshSplitComponent->SetInstanceTransforms(InstancedObjectTransforms);
+
+		ComponentInstanceIndices.SetNumUninitialized(InstancedObjectTransforms.Num());
+		for (int32 InstIndex = 0; InstIndex < InstancedObjectTransforms.Num(); InstIndex++)
+			ComponentInstanceIndices[InstIndex] = InstIndex;
+	}
+
+	// if we have vertex color overrides, apply them now
+#if WITH_EDITOR
+	if (InstanceColors.Num() > 0)
+	{
 		// Apply them to the instances
 		TArray<class UStaticMeshComponent*>& Instances = MeshSplitComponent->GetInstancesForWrite();
-		for (int32 InstIndex = 0; InstIndex < Instances.Num(); InstIndex++)
+		for (int32 CompIndex = 0; CompIndex < Instances.Num(); CompIndex++)
 		{
-			UStaticMeshComponent* CurSMC = Instances[InstIndex];
+			UStaticMeshComponent* CurSMC = Instances[CompIndex];
 			if (!CurSMC || CurSMC->IsPendingKill())
 				continue;
 
+			if (!ComponentInstanceIndices.IsValidIndex(CompIndex))
+				continue;
+
+			const int32 InstIndex = ComponentInstanceIndices[CompIndex];
 			if (!InstanceColors.IsValidIndex(InstIndex))
 				continue;
 
@@ -2140,16 +2585,20 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 	// if failing to find the attrib on a component, skip the rest
 	if (AllPropertyAttributes.Num() > 0)
 	{
+		// Grouped instances all have the attribute values of the group's first instance
 		TArray<class UStaticMeshComponent*>& Instances = MeshSplitComponent->GetInstancesForWrite();
-		for (int32 InstIndex = 0; InstIndex < Instances.Num(); InstIndex++)
+		for (int32 CompIndex = 0; CompIndex < Instances.Num(); CompIndex++)
 		{
-			UStaticMeshComponent* CurSMC = Instances[InstIndex];
+			UStaticMeshComponent* CurSMC = Instances[CompIndex];
 			if (!CurSMC || CurSMC->IsPendingKill())
 				continue;
 
+			if (!ComponentInstanceIndices.IsValidIndex(CompIndex))
+				continue;
+
 			for (const auto& CurrentAttrib : AllPropertyAttributes)
 			{
-				UpdateGenericPropertiesAttributes(CurSMC, AllPropertyAttributes, InstIndex);
+				UpdateGenericPropertiesAttributes(CurSMC, AllPropertyAttributes, ComponentInstanceIndices[CompIndex]);
 			}
 		}
 	}
@@ -2616,7 +3065,7 @@ FHoudiniInstanceTranslator::GetInstancerMaterials(
 		{
 			// See if we can find a material interface that matches the attribute
 			CurrentMaterialInterface = Cast<UMaterialInterface>(
-				StaticLoadObject(UMaterialInterface::StaticClass(), nullptr, *CurrentMatString, nullptr, LOAD_NoWarn, nullptr));
+				FHoudiniEngineUtils::LoadObjectFromPathCached(CurrentMatString, UMaterialInterface::StaticClass()));
 
 			// Check validity
 			if (!CurrentMaterialInterface || CurrentMaterialInterface->IsPendingKill())
@@ -40,6 +40,7 @@ class UStaticMesh;
 class UFoliageType;
 class UHoudiniStaticMesh;
 class UHoudiniInstancedActorComponent;
+class UInstancedStaticMeshComponent;
 
 USTRUCT()
 struct HOUDINIENGINE_API FHoudiniInstancedOutputPerSplitAttributes
@@ -71,6 +72,10 @@ public:
 	UPROPERTY()
 	bool bForceHISM;
 
+	// Size of the cells used to split the instances in multiple components, 0 if disabled
+	UPROPERTY()
+	float InstancerCellSize = 0.0f;
+
 	UPROPERTY()
 	TArray<UObject*> OriginalInstancedObjects;
 
@@ -237,6 +242,38 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			UMaterialInterface * InstancerMaterial = nullptr,
 			const bool& bForceHISM = false);
 
+		// Splits the static mesh variations in the cells of a regular grid on the XY plane, each variation is replaced by one entry per cell.
+		// OutVariationSourceIndices gives the index of each entry's variation before the split,
+		// and OutVariationCellSuffixes the suffix to add to its split identifier (empty if the variation wasn't split).
+		static void SplitInstanceVariationsInCells(
+			const float& InCellSize,
+			TArray<TSoftObjectPtr<UObject>>& InOutVariationObjects,
+			TArray<TArray<FTransform>>& InOutVariationTransforms,
+			TArray<int32>& InOutVariationOriginalObjectIndices,
+			TArray<int32>& InOutVariationIndices,
+			TArray<int32>& OutVariationSourceIndices,
+			TArray<FString>& OutVariationCellSuffixes);
+
+		// Splits the instance transforms in the cells of a regular grid on the XY plane.
+		// Returns false if the transforms don't need to be split (no cell size or all the instances in a single cell).
+		static bool SplitInstanceTransformsInCells(
+			const TArray<FTransform>& InTransforms,
+			const float& InCellSize,
+			TArray<FIntPoint>& OutCells,
+			TArray<TArray<FTransform>>& OutCellTransforms);
+
+		// Returns the split identifier of an instancer's variation (ORIG_VAR), without the cell suffix
+		static FString GetVariationSplitIdentifier(const FString& InSplitIdentifier);
+
+		// Returns the cell size used to split the instancer, from the attribute or the runtime settings
+		static float GetInstancerCellSize(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId);
+
+		// Update the instances of an ISMC / HISMC to match the given transforms.
+		// Only the modified instances are updated, unless most of them have changed.
+		static void UpdateInstancedStaticMeshComponentInstances(
+			UInstancedStaticMeshComponent* InISMC,
+			const TArray<FTransform>& InstancedObjectTransforms);
+
 		// Create or update an IAC
 		static bool CreateOrUpdateInstancedActorComponent(
 			UObject* InstancedObject,
@@ -303,6 +340,16 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			ULevel* InSpawnLevel, 
 			UHoudiniInstancedActorComponent* InIAC);
 
+		// Spawns the instance actors that didn't fit in the spawn time budget of their cook
+		// Used as a core ticker, returns false once there's nothing left to spawn
+		static bool TickPendingInstanceActorSpawns(float DeltaTime);
+
+		// Immediately spawns the pending instance actors of the given component, or of all components if null
+		static void FlushPendingInstanceActorSpawns(UHoudiniInstancedActorComponent* InIAC = nullptr);
+
+		// Forgets all the pending instance actors and removes their ticker
+		static void ClearPendingInstanceActorSpawns();
+
 		// Helper functions for generic property attributes
 		static bool GetGenericPropertiesAttributes(
 			const int32& InGeoNodeId,
@@ -70,6 +70,12 @@
 #include "Misc/AssetRegistryInterface.h"
 #include "Misc/StringFormatArg.h"
 #include "Engine/WorldComposition.h"
+#include "Async/Async.h"
+#include "Misc/Compression.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UnrealLandscapeTranslator.h"
 
 #if WITH_EDITOR
 	#include "LandscapeEditorModule.h"
@@ -88,8 +94,183 @@ static TAutoConsoleVariable<int32> CVarHoudiniEngineExportLandscapeTextures(
 	TEXT("1: Enabled\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineCompressLandscapeBackups(
+	TEXT("HoudiniEngine.CompressLandscapeBackups"),
+	1,
+	TEXT("If enabled, the backups of input landscapes that are updated by Houdini are LZ4 compressed.\n")
+	TEXT("0: Disabled\n")
+	TEXT("1: Enabled\n")
+);
+
 typedef FHoudiniEngineUtils FHUtils;
 
+// Landscape backup cache files contain a header (magic, version, landscape extent and band size)
+// followed by the height data and each layer's data.
+// Data is split in bands of landscape component rows that are stored raw, or LZ4 compressed when smaller,
+// so they can be compressed and decompressed in parallel.
+static const uint32 HoudiniLandscapeCacheMagic = 0x314C4348; // "HCL1"
+static const int32 HoudiniLandscapeCacheVersion = 1;
+static const TCHAR* HoudiniLandscapeCacheExtension = TEXT(".hlcache");
+
+template<typename T>
+static void
+WriteLandscapeCacheData(FArchive& Ar, const TArray<T>& Data, const int32& SizeX, const int32& SizeY, const int32& RowsPerBand, const bool& bCompress)
+{
+	int32 NumBands = FMath::DivideAndRoundUp(SizeY, RowsPerBand);
+	TArray<TArray<uint8>> Bands;
+	Bands.SetNum(NumBands);
+	TArray<int32> BandSizes;
+	BandSizes.SetNum(NumBands);
+
+	ParallelFor(NumBands, [&](int32 BandIdx)
+	{
+		const int32 FirstRow = BandIdx * RowsPerBand;
+		const int32 NumRows = FMath::Min(RowsPerBand, SizeY - FirstRow);
+		const uint8* Source = (const uint8*)(Data.GetData() + FirstRow * SizeX);
+		const int32 SourceSize = NumRows * SizeX * sizeof(T);
+		BandSizes[BandIdx] = SourceSize;
+
+		TArray<uint8>& Band = Bands[BandIdx];
+		if (bCompress)
+		{
+			int32 CompressedSize = FCompression::CompressMemoryBound(NAME_LZ4, SourceSize);
+			Band.SetNumUninitialized(CompressedSize);
+			if (FCompression::CompressMemory(NAME_LZ4, Band.GetData(), CompressedSize, Source, SourceSize)
+				&& CompressedSize < SourceSize)
+			{
+				Band.SetNum(CompressedSize, false);
+				return;
+			}
+		}
+
+		// Store the band raw
+		Band.SetNumUninitialized(SourceSize);
+		FMemory::Memcpy(Band.GetData(), Source, SourceSize);
+	});
+
+	Ar << NumBands;
+	for (int32 BandIdx = 0; BandIdx < NumBands; BandIdx++)
+	{
+		int32 StoredSize = Bands[BandIdx].Num();
+		Ar << BandSizes[BandIdx];
+		Ar << StoredSize;
+		Ar.Serialize(Bands[BandIdx].GetData(), StoredSize);
+	}
+}
+
+template<typename T>
+static bool
+ReadLandscapeCacheData(FArchive& Ar, const TArray<uint8>& FileData, TArray<T>& OutData, const int32& SizeX, const int32& SizeY, const int32& RowsPerBand)
+{
+	int32 NumBands = 0;
+	Ar << NumBands;
+	if (Ar.IsError() || NumBands != FMath::DivideAndRoundUp(SizeY, RowsPerBand))
+		return false;
+
+	// Locate all the bands first, the data is then read directly from the file's buffer
+	TArray<int64> BandOffsets;
+	TArray<int32> BandStoredSizes;
+	BandOffsets.SetNum(NumBands);
+	BandStoredSizes.SetNum(NumBands);
+	for (int32 BandIdx = 0; BandIdx < NumBands; BandIdx++)
+	{
+		int32 BandSize = 0;
+		int32 StoredSize = 0;
+		Ar << BandSize;
+		Ar << StoredSize;
+
+		const int32 NumRows = FMath::Min(RowsPerBand, SizeY - BandIdx * RowsPerBand);
+		if (Ar.IsError() || BandSize != NumRows * SizeX * (int32)sizeof(T) || StoredSize <= 0 || StoredSize > BandSize)
+			return false;
+
+		BandOffsets[BandIdx] = Ar.Tell();
+		BandStoredSizes[BandIdx] = StoredSize;
+		if (BandOffsets[BandIdx] + StoredSize > FileData.Num())
+			return false;
+
+		Ar.Seek(BandOffsets[BandIdx] + StoredSize);
+	}
+
+	OutData.SetNumUninitialized(SizeX * SizeY);
+	TAtomic<bool> bSuccess(true);
+	ParallelFor(NumBands, [&](int32 BandIdx)
+	{
+		const int32 FirstRow = BandIdx * RowsPerBand;
+		const int32 NumRows = FMath::Min(RowsPerBand, SizeY - FirstRow);
+		const int32 BandSize = NumRows * SizeX * sizeof(T);
+		uint8* Dest = (uint8*)(OutData.GetData() + FirstRow * SizeX);
+		const uint8* Source = FileData.GetData() + BandOffsets[BandIdx];
+
+		if (BandStoredSizes[BandIdx] == BandSize)
+			FMemory::Memcpy(Dest, Source, BandSize);
+		else if (!FCompression::UncompressMemory(NAME_LZ4, Dest, BandSize, Source, BandStoredSizes[BandIdx]))
+			bSuccess = false;
+	});
+
+	return bSuccess;
+}
+
+// Calls SetRegionData for each run of consecutive landscape components whose hash has changed.
+// Regions are given in the tile's coordinates, with their data copied to a contiguous buffer.
+// Returns the number of modified components.
+template<typename TDataType, typename TSetRegionFunc>
+static int32
+SetModifiedLandscapeComponentsData(
+	const TArray<TDataType>& InData,
+	const int32& SizeX, const int32& SizeY,
+	const int32& ComponentSizeQuads,
+	const TArray<uint32>& PreviousHashes,
+	const TArray<uint32>& NewHashes,
+	const TSetRegionFunc& SetRegionData)
+{
+	const int32 NumComponentsX = FMath::DivideAndRoundUp(SizeX - 1, ComponentSizeQuads);
+	const int32 NumComponentsY = FMath::DivideAndRoundUp(SizeY - 1, ComponentSizeQuads);
+	if (PreviousHashes.Num() != NumComponentsX * NumComponentsY || NewHashes.Num() != PreviousHashes.Num())
+		return INDEX_NONE;
+
+	int32 NumModifiedComponents = 0;
+	TArray<TDataType> RegionData;
+	for (int32 CompY = 0; CompY < NumComponentsY; CompY++)
+	{
+		int32 RunStartX = INDEX_NONE;
+		for (int32 CompX = 0; CompX <= NumComponentsX; CompX++)
+		{
+			const int32 HashIdx = CompX + CompY * NumComponentsX;
+			if (CompX < NumComponentsX && PreviousHashes[HashIdx] != NewHashes[HashIdx])
+			{
+				NumModifiedComponents++;
+				if (RunStartX == INDEX_NONE)
+					RunStartX = CompX;
+				continue;
+			}
+
+			if (RunStartX == INDEX_NONE)
+				continue;
+
+			// Copy the region covered by this run of components and set it
+			const int32 X1 = RunStartX * ComponentSizeQuads;
+			const int32 X2 = FMath::Min(CompX * ComponentSizeQuads, SizeX - 1);
+			const int32 Y1 = CompY * ComponentSizeQuads;
+			const int32 Y2 = FMath::Min(Y1 + ComponentSizeQuads, SizeY - 1);
+			const int32 RegionSizeX = X2 - X1 + 1;
+
+			RegionData.SetNumUninitialized(RegionSizeX * (Y2 - Y1 + 1));
+			for (int32 Y = Y1; Y <= Y2; Y++)
+			{
+				FMemory::Memcpy(
+					RegionData.GetData() + (Y - Y1) * RegionSizeX,
+					InData.GetData() + X1 + Y * SizeX,
+					RegionSizeX * sizeof(TDataType));
+			}
+
+			SetRegionData(X1, Y1, X2, Y2, RegionData.GetData());
+			RunStartX = INDEX_NONE;
+		}
+	}
+
+	return NumModifiedComponents;
+}
+
 bool
 FHoudiniLandscapeTranslator::CreateLandscape(
 	UHoudiniOutput* InOutput,
@@ -102,7 +283,8 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	const TMap<FString, float>& LayerMinimums,
 	const TMap<FString, float>& LayerMaximums,
 	FHoudiniPackageParams InPackageParams,
-	TArray<UPackage*>& OutCreatedPackages
+	TArray<UPackage*>& OutCreatedPackages,
+	FHoudiniLandscapeTileData* InTileData
 )
 {
 	check(LayerMinimums.Contains(TEXT("height")));
@@ -311,11 +493,15 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	UPhysicalMaterial* LandscapePhysicalMaterial = nullptr;
 	FHoudiniLandscapeTranslator::GetLandscapeMaterials(*Heightfield, LandscapeMaterial, LandscapeHoleMaterial, LandscapePhysicalMaterial);
 
-	// Extract the float data from the Heightfield.
+	// Only use the prepared tile data if it has been created for this heightfield
+	if (InTileData && InTileData->Heightfield != Heightfield)
+		InTileData = nullptr;
+
+	// Extract the float data from the Heightfield, unless it has already been fetched and converted.
 	const FHoudiniVolumeInfo &VolumeInfo = Heightfield->VolumeInfo;
 	TArray<float> FloatValues;
 	float FloatMin, FloatMax;
-	if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
+	if (!InTileData && !GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
 		return false;
 
 	// Heightfield conversions should always use the global float min/max
@@ -344,7 +530,7 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	// ----------------------------------------------------
 	// Export textures, if enabled. Mostly used for debugging at the moment.
 	bool bExportTexture = CVarHoudiniEngineExportLandscapeTextures.GetValueOnAnyThread() == 1 ? true : false;
-	if (bExportTexture)
+	if (bExportTexture && FloatValues.Num() > 0)
 	{
 		// Export raw height data to texture
 		FString TextureName = TilePackageParams.ObjectName + TEXT("_height_raw");
@@ -360,7 +546,10 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 
 	// Look for all the layers/masks corresponding to the current heightfield.
 	TArray< const FHoudiniGeoPartObject* > FoundLayers;
-	FHoudiniLandscapeTranslator::GetHeightfieldsLayersFromOutput(InOutput, *Heightfield, FoundLayers);
+	if (InTileData)
+		FoundLayers = InTileData->FoundLayers;
+	else
+		FHoudiniLandscapeTranslator::GetHeightfieldsLayersFromOutput(InOutput, *Heightfield, FoundLayers);
 
 	// Get the updated layers.
 	TArray<FLandscapeImportLayerInfo> LayerInfos;
@@ -369,18 +558,51 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		LayerMinimums, LayerMaximums, LayerInfos, false,
 		TilePackageParams,
 		LayerPackageParams,
-		OutCreatedPackages))
+		OutCreatedPackages,
+		InTileData ? &InTileData->Layers : nullptr))
 		return false;
 
 	// Convert Houdini's heightfield data to Unreal's landscape data
 	TArray<uint16> IntHeightData;
 	FTransform TileTransform;
-	if (!FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
+	if (InTileData)
+	{
+		// Wait for the conversion of this tile's height data
+		if (!InTileData->ConversionResult.IsValid() || !InTileData->ConversionResult.Get())
+			return false;
+
+		if (InTileData->UnrealTileSizeX != UnrealTileSizeX || InTileData->UnrealTileSizeY != UnrealTileSizeY)
+			return false;
+
+		IntHeightData = MoveTemp(InTileData->IntHeightData);
+		TileTransform = InTileData->TileTransform;
+	}
+	else if (!FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 		FloatValues, VolumeInfo,
 		UnrealTileSizeX, UnrealTileSizeY,
 		FloatMin, FloatMax,
 		IntHeightData, TileTransform))
+	{
 		return false;
+	}
+
+	// Hash the data of each landscape component, so that we can only update the components that differ from the landscape
+	const int32 ComponentSizeQuads = NumSectionPerLandscapeComponent * NumQuadsPerLandscapeSection;
+	TArray<uint32> HeightComponentHashes;
+	FUnrealLandscapeTranslator::ComputeLandscapeComponentHashes(
+		IntHeightData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads, HeightComponentHashes);
+
+	TMap<FName, TArray<uint32>> LayerComponentHashes;
+	for (const FLandscapeImportLayerInfo& CurrentLayerInfo : LayerInfos)
+	{
+		FUnrealLandscapeTranslator::ComputeLandscapeComponentHashes(
+			CurrentLayerInfo.LayerData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads,
+			LayerComponentHashes.FindOrAdd(CurrentLayerInfo.LayerName));
+	}
+
+	// Hashes of the data currently in the landscape, if we're updating an existing one
+	TArray<uint32> PreviousHeightComponentHashes;
+	TMap<FName, TArray<uint32>> PreviousLayerComponentHashes;
 
 	// ----------------------------------------------------
 	// Property changes that we want to track
@@ -398,6 +620,8 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	bool bCreatedTileActor = false;
 	bool bHeightLayerDataChanged = false;
 	bool bCustomLayerDataChanged = false;
+	// Only the modified components were updated, normals have been updated by the accessors
+	bool bPartialUpdate = false;
 
 	// ----------------------------------------------------
 	// Calculate Tile location and landscape offset
@@ -773,7 +997,8 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		// If we change the number of tiles, or switch from outputting single tile to multiple,
 		// then its fairly likely that the unreal transform has changed even if the
 		// Houdini Transform remained the same
-		if (!TileActor->GetTransform().Equals(TileTransform))
+		const bool bTileTransformChanged = !TileActor->GetTransform().Equals(TileTransform);
+		if (bTileTransformChanged)
 		{
 			// HOUDINI_LOG_DISPLAY(TEXT("[CreateLandscape] Updating tile transform: %s"), *(TileTransform.ToString()));
 			TileActor->SetActorTransform(TileTransform);
@@ -832,6 +1057,37 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		const int32 MinY = TileLoc.Y;
 		const int32 MaxY = TileLoc.Y + UnrealTileSizeY - 1;
 
+		// If the tile has not moved, read back the data currently in the landscape and hash it, so we can
+		// only update the components that differ from the cook's data. Comparing against the landscape itself
+		// (and not against the previous cook) makes sure manual edits and undos are overwritten by the output.
+		const bool bCanUpdateModifiedComponentsOnly = !bTileTransformChanged;
+		if (bCanUpdateModifiedComponentsOnly)
+		{
+			FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+			if (Heightfield->bHasGeoChanged)
+			{
+				TArray<uint16> CurrentHeightData;
+				CurrentHeightData.SetNumZeroed(UnrealTileSizeX * UnrealTileSizeY);
+				LandscapeEdit.GetHeightDataFast(MinX, MinY, MaxX, MaxY, CurrentHeightData.GetData(), 0);
+				FUnrealLandscapeTranslator::ComputeLandscapeComponentHashes(
+					CurrentHeightData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads, PreviousHeightComponentHashes);
+			}
+
+			for (const FLandscapeImportLayerInfo& CurrentLayerInfo : LayerInfos)
+			{
+				if (!CurrentLayerInfo.LayerInfo)
+					continue;
+
+				TArray<uint8> CurrentLayerData;
+				CurrentLayerData.SetNumZeroed(UnrealTileSizeX * UnrealTileSizeY);
+				LandscapeEdit.GetWeightDataFast(CurrentLayerInfo.LayerInfo, MinX, MinY, MaxX, MaxY, CurrentLayerData.GetData(), 0);
+				FUnrealLandscapeTranslator::ComputeLandscapeComponentHashes(
+					CurrentLayerData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads,
+					PreviousLayerComponentHashes.FindOrAdd(CurrentLayerInfo.LayerName));
+			}
+		}
+		bPartialUpdate = bCanUpdateModifiedComponentsOnly;
+
 		// NOTE: Use HeightmapAccessor / AlphamapAccessor instead of FLandscapeEditDataInterface.
 		// FLandscapeEditDataInterface is a more low level data interface, used internally by the *Accessor tools
 		// though the *Accessors do additional things like update normals and foliage.
@@ -842,16 +1098,54 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 			// It is important to update the heightmap through the this since it will properly
 			// update normals and foliage.
 			FHeightmapAccessor<false> HeightmapAccessor(LandscapeInfo);
-			HeightmapAccessor.SetData(MinX, MinY, MaxX, MaxY, IntHeightData.GetData());
 
-			bHeightLayerDataChanged = true;
+			// Only update the components that have been modified if we can
+			int32 NumModifiedComponents = INDEX_NONE;
+			if (bCanUpdateModifiedComponentsOnly)
+			{
+				NumModifiedComponents = SetModifiedLandscapeComponentsData(
+					IntHeightData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads,
+					PreviousHeightComponentHashes, HeightComponentHashes,
+					[&HeightmapAccessor, MinX, MinY](const int32& X1, const int32& Y1, const int32& X2, const int32& Y2, uint16* RegionData)
+					{
+						HeightmapAccessor.SetData(MinX + X1, MinY + Y1, MinX + X2, MinY + Y2, RegionData);
+					});
+			}
+
+			if (NumModifiedComponents == INDEX_NONE)
+			{
+				HeightmapAccessor.SetData(MinX, MinY, MaxX, MaxY, IntHeightData.GetData());
+				bPartialUpdate = false;
+			}
+
+			bHeightLayerDataChanged = NumModifiedComponents != 0;
 		}
 
 		// Update the layers on the landscape.
 		for (FLandscapeImportLayerInfo &NextUpdatedLayerInfo : LayerInfos)
 		{
 			FAlphamapAccessor<false, true> AlphaAccessor(LandscapeInfo, NextUpdatedLayerInfo.LayerInfo);
-			AlphaAccessor.SetData(MinX, MinY, MaxX, MaxY, NextUpdatedLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+
+			// Only update the components that have been modified if we can
+			int32 NumModifiedComponents = INDEX_NONE;
+			const TArray<uint32>* PreviousLayerHashes = PreviousLayerComponentHashes.Find(NextUpdatedLayerInfo.LayerName);
+			const TArray<uint32>* NewLayerHashes = LayerComponentHashes.Find(NextUpdatedLayerInfo.LayerName);
+			if (bCanUpdateModifiedComponentsOnly && PreviousLayerHashes && NewLayerHashes)
+			{
+				NumModifiedComponents = SetModifiedLandscapeComponentsData(
+					NextUpdatedLayerInfo.LayerData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads,
+					*PreviousLayerHashes, *NewLayerHashes,
+					[&AlphaAccessor, MinX, MinY](const int32& X1, const int32& Y1, const int32& X2, const int32& Y2, uint8* RegionData)
+					{
+						AlphaAccessor.SetData(MinX + X1, MinY + Y1, MinX + X2, MinY + Y2, RegionData, ELandscapeLayerPaintingRestriction::None);
+					});
+			}
+
+			if (NumModifiedComponents == INDEX_NONE)
+			{
+				AlphaAccessor.SetData(MinX, MinY, MaxX, MaxY, NextUpdatedLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+				bPartialUpdate = false;
+			}
 		
 			if (NextUpdatedLayerInfo.LayerInfo && NextUpdatedLayerInfo.LayerName.ToString().Equals(TEXT("Visibility"), ESearchCase::IgnoreCase))
 			{
@@ -944,6 +1238,7 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		TileActor->PostEditChange();
 	}
 
+	if (!bPartialUpdate)
 	{
 		FLandscapeEditDataInterface LandscapeEdit(TileActor->GetLandscapeInfo());
 		LandscapeEdit.RecalculateNormals();
@@ -970,6 +1265,137 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	return true;
 }
 
+void
+FHoudiniLandscapeTranslator::PrepareLandscapeTilesData(
+	const TArray<UHoudiniOutput*>& InOutputs,
+	const TMap<FString, float>& LayerMinimums,
+	const TMap<FString, float>& LayerMaximums,
+	const int32& InMaxTilesInFlight,
+	int32& InOutNextOutputIdx,
+	TMap<UHoudiniOutput*, TUniquePtr<FHoudiniLandscapeTileData>>& InOutTilesData)
+{
+	// Texture exports need the raw Houdini data, let CreateLandscape fetch it
+	if (CVarHoudiniEngineExportLandscapeTextures.GetValueOnAnyThread() == 1)
+		return;
+
+	const float* GlobalHeightMin = LayerMinimums.Find(TEXT("height"));
+	const float* GlobalHeightMax = LayerMaximums.Find(TEXT("height"));
+	if (!GlobalHeightMin || !GlobalHeightMax)
+		return;
+
+	const float HeightMin = *GlobalHeightMin;
+	const float HeightMax = *GlobalHeightMax;
+
+	// Only keep a limited number of tiles in flight, to bound the memory used by the fetched data
+	for (; InOutNextOutputIdx < InOutputs.Num() && InOutTilesData.Num() < InMaxTilesInFlight; InOutNextOutputIdx++)
+	{
+		UHoudiniOutput* CurOutput = InOutputs[InOutNextOutputIdx];
+		if (!CurOutput || CurOutput->IsPendingKill())
+			continue;
+
+		if (CurOutput->GetType() != EHoudiniOutputType::Landscape)
+			continue;
+
+		const FHoudiniGeoPartObject* Heightfield = GetHoudiniHeightFieldFromOutput(CurOutput);
+		if (!Heightfield || Heightfield->Type != EHoudiniPartType::Volume)
+			continue;
+
+		TUniquePtr<FHoudiniLandscapeTileData> TileData = MakeUnique<FHoudiniLandscapeTileData>();
+		TileData->Heightfield = Heightfield;
+
+		int32 NumSectionPerLandscapeComponent = -1;
+		int32 NumQuadsPerLandscapeSection = -1;
+		if (!CalcLandscapeSizeFromHeightfieldSize(
+			Heightfield->VolumeInfo.YLength, Heightfield->VolumeInfo.XLength,
+			TileData->UnrealTileSizeX, TileData->UnrealTileSizeY,
+			NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection))
+			continue;
+
+		TArray<float> FloatValues;
+		float FloatMin, FloatMax;
+		if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
+			continue;
+
+		// Convert the height data on the thread pool while we fetch the next volumes.
+		// Conversions always use the global min/max, as in CreateLandscape.
+		FHoudiniLandscapeTileData* TileDataPtr = TileData.Get();
+		TileData->ConversionResult = Async(EAsyncExecution::ThreadPool,
+			[TileDataPtr, FloatValues = MoveTemp(FloatValues), HeightMin, HeightMax]()
+			{
+				return ConvertHeightfieldDataToLandscapeData(
+					FloatValues, TileDataPtr->Heightfield->VolumeInfo,
+					TileDataPtr->UnrealTileSizeX, TileDataPtr->UnrealTileSizeY,
+					HeightMin, HeightMax,
+					TileDataPtr->IntHeightData, TileDataPtr->TileTransform);
+			});
+
+		// Do the same for the tile's layers.
+		// The array is sized before launching the conversions, as they write to its elements.
+		GetHeightfieldsLayersFromOutput(CurOutput, *Heightfield, TileData->FoundLayers);
+		TileData->Layers.SetNum(TileData->FoundLayers.Num());
+		for (int32 LayerIdx = 0; LayerIdx < TileData->FoundLayers.Num(); LayerIdx++)
+		{
+			const FHoudiniGeoPartObject* LayerGeoPartObject = TileData->FoundLayers[LayerIdx];
+			FHoudiniLandscapeLayerTileData& CurrentLayer = TileData->Layers[LayerIdx];
+			CurrentLayer.LayerGeoPartObject = LayerGeoPartObject;
+
+			if (!LayerGeoPartObject || !LayerGeoPartObject->IsValid())
+				continue;
+
+			if (!FHoudiniEngineUtils::IsHoudiniNodeValid(LayerGeoPartObject->AssetId))
+				continue;
+
+			TArray<float> FloatLayerData;
+			float LayerMin = 0;
+			float LayerMax = 0;
+			if (!GetHoudiniHeightfieldFloatData(LayerGeoPartObject, FloatLayerData, LayerMin, LayerMax))
+				continue;
+
+			// No need to create flat layers as Unreal will remove them afterwards..
+			if (LayerMin == LayerMax)
+				continue;
+
+			// Unit layers are in [0-1], others are converted using the global Min/Max
+			const FString& LayerName = LayerGeoPartObject->VolumeInfo.Name;
+			if (IsUnitLandscapeLayer(*LayerGeoPartObject))
+			{
+				LayerMin = 0.0f;
+				LayerMax = 1.0f;
+			}
+			else
+			{
+				if (LayerMaximums.Contains(LayerName))
+					LayerMax = LayerMaximums[LayerName];
+
+				if (LayerMinimums.Contains(LayerName))
+					LayerMin = LayerMinimums[LayerName];
+			}
+
+			CurrentLayer.bSkipLayer = false;
+			CurrentLayer.LayerMin = LayerMin;
+			CurrentLayer.LayerMax = LayerMax;
+
+			// HF masks need their X/Y sizes swapped
+			FHoudiniLandscapeLayerTileData* LayerPtr = &CurrentLayer;
+			const int32 HoudiniXSize = LayerGeoPartObject->VolumeInfo.YLength;
+			const int32 HoudiniYSize = LayerGeoPartObject->VolumeInfo.XLength;
+			const int32 LandscapeXSize = TileData->UnrealTileSizeX;
+			const int32 LandscapeYSize = TileData->UnrealTileSizeY;
+			CurrentLayer.ConversionResult = Async(EAsyncExecution::ThreadPool,
+				[LayerPtr, FloatLayerData = MoveTemp(FloatLayerData), HoudiniXSize, HoudiniYSize, LandscapeXSize, LandscapeYSize]()
+				{
+					return ConvertHeightfieldLayerToLandscapeLayer(
+						FloatLayerData, HoudiniXSize, HoudiniYSize,
+						LayerPtr->LayerMin, LayerPtr->LayerMax,
+						LandscapeXSize, LandscapeYSize,
+						LayerPtr->LayerData);
+				});
+		}
+
+		InOutTilesData.Add(CurOutput, MoveTemp(TileData));
+	}
+}
+
 bool
 FHoudiniLandscapeTranslator::IsLandscapeInfoCompatible(
 	const ULandscapeInfo* LandscapeInfo,
@@ -1436,23 +1862,22 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	// Converting the data from Houdini to Unreal
 	// For correct orientation in unreal, the point matrix has to be transposed.
 	IntHeightData.SetNumUninitialized(SizeInPoints);
+	if (HeightfieldFloatValues.Num() < SizeInPoints)
+		return false;
 
-	int32 nUnreal = 0;
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
+	// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
+	const double DoubleFloatMin = (double)FloatMin;
+	FHoudiniEngineUtils::TransposeAndConvertData(
+		HeightfieldFloatValues.GetData(), IntHeightData.GetData(), HoudiniXSize, HoudiniYSize,
+		[DoubleFloatMin, ZSpacing, DigitCenterOffset](const float& FloatValue)
 		{
-			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-			int32 nHoudini = nY + nX * HoudiniYSize;
-
 			// Get the double values in [0 - ZRange]
-			double DoubleValue = (double)HeightfieldFloatValues[nHoudini] - (double)FloatMin;
+			double DoubleValue = (double)FloatValue - DoubleFloatMin;
 
 			// Then convert it to [0 - DesiredRange] and center it 
 			DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
-			IntHeightData[nUnreal++] = FMath::RoundToInt(DoubleValue);
-		}
-	}
+			return (uint16)FMath::RoundToInt(DoubleValue);
+		});
 
 	//--------------------------------------------------------------------------------------------------
 	// 2. Resample / Pad the int data so that if fits unreal size requirements
@@ -1570,6 +1995,77 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldDataToLandscapeData(
 	return true;
 }
 
+// Catmull-Rom cubic kernel, X is the distance to the sample
+static float
+ResampleBicubicKernel(float X)
+{
+	X = FMath::Abs(X);
+	if (X < 1.0f)
+		return (1.5f * X - 2.5f) * X * X + 1.0f;
+	if (X < 2.0f)
+		return ((-0.5f * X + 2.5f) * X - 4.0f) * X + 2.0f;
+	return 0.0f;
+}
+
+// Lanczos kernel with 3 lobes, X is the distance to the sample
+static float
+ResampleLanczosKernel(float X)
+{
+	X = FMath::Abs(X);
+	if (X < KINDA_SMALL_NUMBER)
+		return 1.0f;
+	if (X >= 3.0f)
+		return 0.0f;
+
+	const float PiX = PI * X;
+	return 3.0f * FMath::Sin(PiX) * FMath::Sin(PiX / 3.0f) / (PiX * PiX);
+}
+
+// Computes the source indices and normalized weights used to resample a line of OldSize values to NewSize values.
+// Corners are aligned (first and last values map to each other), indices are clamped to the edges.
+// When downsampling, the kernel is widened so that all the source values contribute to the result.
+static void
+ComputeResampleTaps(
+	const int32& OldSize, const int32& NewSize,
+	const EHoudiniLandscapeResamplingMode& Mode,
+	TArray<int32>& OutIndices, TArray<float>& OutWeights, int32& OutNumTaps)
+{
+	const float Scale = NewSize > 1 ? (float)(OldSize - 1) / (float)(NewSize - 1) : 0.0f;
+	const float Support = (Mode == EHoudiniLandscapeResamplingMode::Lanczos) ? 3.0f : 2.0f;
+	const float FilterScale = FMath::Max(1.0f, Scale);
+	const int32 Radius = FMath::CeilToInt(Support * FilterScale);
+
+	OutNumTaps = Radius * 2;
+	OutIndices.SetNumUninitialized(NewSize * OutNumTaps);
+	OutWeights.SetNumUninitialized(NewSize * OutNumTaps);
+
+	for (int32 Idx = 0; Idx < NewSize; Idx++)
+	{
+		const float Center = Idx * Scale;
+		const int32 First = FMath::FloorToInt(Center) - Radius + 1;
+
+		float WeightSum = 0.0f;
+		for (int32 Tap = 0; Tap < OutNumTaps; Tap++)
+		{
+			const float Distance = ((float)(First + Tap) - Center) / FilterScale;
+			const float Weight = (Mode == EHoudiniLandscapeResamplingMode::Lanczos)
+				? ResampleLanczosKernel(Distance)
+				: ResampleBicubicKernel(Distance);
+
+			OutIndices[Idx * OutNumTaps + Tap] = FMath::Clamp(First + Tap, 0, OldSize - 1);
+			OutWeights[Idx * OutNumTaps + Tap] = Weight;
+			WeightSum += Weight;
+		}
+
+		// Normalize the weights
+		if (!FMath::IsNearlyZero(WeightSum))
+		{
+			for (int32 Tap = 0; Tap < OutNumTaps; Tap++)
+				OutWeights[Idx * OutNumTaps + Tap] /= WeightSum;
+		}
+	}
+}
+
 template<typename T>
 TArray<T> ResampleData(const TArray<T>& Data, int32 OldWidth, int32 OldHeight, int32 NewWidth, int32 NewHeight)
 {
@@ -1577,26 +2073,80 @@ TArray<T> ResampleData(const TArray<T>& Data, int32 OldWidth, int32 OldHeight, i
 	Result.Empty(NewWidth * NewHeight);
 	Result.AddUninitialized(NewWidth * NewHeight);
 
-	const float XScale = (float)(OldWidth - 1) / (NewWidth - 1);
-	const float YScale = (float)(OldHeight - 1) / (NewHeight - 1);
-	for (int32 Y = 0; Y < NewHeight; ++Y)
+	EHoudiniLandscapeResamplingMode Mode = EHoudiniLandscapeResamplingMode::Bilinear;
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+	if (HoudiniRuntimeSettings)
+		Mode = HoudiniRuntimeSettings->MarshallingLandscapesResamplingMode;
+
+	if (Mode == EHoudiniLandscapeResamplingMode::Bilinear)
 	{
-		for (int32 X = 0; X < NewWidth; ++X)
+		const float XScale = (float)(OldWidth - 1) / (NewWidth - 1);
+		const float YScale = (float)(OldHeight - 1) / (NewHeight - 1);
+		ParallelFor(NewHeight, [&](int32 Y)
 		{
-			const float OldY = Y * YScale;
-			const float OldX = X * XScale;
-			const int32 X0 = FMath::FloorToInt(OldX);
-			const int32 X1 = FMath::Min(FMath::FloorToInt(OldX) + 1, OldWidth - 1);
-			const int32 Y0 = FMath::FloorToInt(OldY);
-			const int32 Y1 = FMath::Min(FMath::FloorToInt(OldY) + 1, OldHeight - 1);
-			const T& Original00 = Data[Y0 * OldWidth + X0];
-			const T& Original10 = Data[Y0 * OldWidth + X1];
-			const T& Original01 = Data[Y1 * OldWidth + X0];
-			const T& Original11 = Data[Y1 * OldWidth + X1];
-			Result[Y * NewWidth + X] = FMath::BiLerp(Original00, Original10, Original01, Original11, FMath::Fractional(OldX), FMath::Fractional(OldY));
-		}
+			for (int32 X = 0; X < NewWidth; ++X)
+			{
+				const float OldY = Y * YScale;
+				const float OldX = X * XScale;
+				const int32 X0 = FMath::FloorToInt(OldX);
+				const int32 X1 = FMath::Min(FMath::FloorToInt(OldX) + 1, OldWidth - 1);
+				const int32 Y0 = FMath::FloorToInt(OldY);
+				const int32 Y1 = FMath::Min(FMath::FloorToInt(OldY) + 1, OldHeight - 1);
+				const T& Original00 = Data[Y0 * OldWidth + X0];
+				const T& Original10 = Data[Y0 * OldWidth + X1];
+				const T& Original01 = Data[Y1 * OldWidth + X0];
+				const T& Original11 = Data[Y1 * OldWidth + X1];
+				Result[Y * NewWidth + X] = FMath::BiLerp(Original00, Original10, Original01, Original11, FMath::Fractional(OldX), FMath::Fractional(OldY));
+			}
+		});
+
+		return Result;
 	}
 
+	// Bicubic and Lanczos filters are separable: resample the rows first, then the columns.
+	TArray<int32> IndicesX, IndicesY;
+	TArray<float> WeightsX, WeightsY;
+	int32 NumTapsX = 0;
+	int32 NumTapsY = 0;
+	ComputeResampleTaps(OldWidth, NewWidth, Mode, IndicesX, WeightsX, NumTapsX);
+	ComputeResampleTaps(OldHeight, NewHeight, Mode, IndicesY, WeightsY, NumTapsY);
+
+	// Horizontal pass, each source row is resampled to the new width
+	TArray<float> RowsResampled;
+	RowsResampled.SetNumUninitialized(NewWidth * OldHeight);
+	ParallelFor(OldHeight, [&](int32 Y)
+	{
+		const T* SourceRow = Data.GetData() + Y * OldWidth;
+		float* DestRow = RowsResampled.GetData() + Y * NewWidth;
+		for (int32 X = 0; X < NewWidth; X++)
+		{
+			float Value = 0.0f;
+			for (int32 Tap = 0; Tap < NumTapsX; Tap++)
+				Value += WeightsX[X * NumTapsX + Tap] * (float)SourceRow[IndicesX[X * NumTapsX + Tap]];
+			DestRow[X] = Value;
+		}
+	});
+
+	// Vertical pass, rows of the intermediate data are accumulated so all the reads stay contiguous
+	const float MaxValue = (float)TNumericLimits<T>::Max();
+	ParallelFor(NewHeight, [&](int32 Y)
+	{
+		TArray<float> Accumulator;
+		Accumulator.SetNumZeroed(NewWidth);
+		for (int32 Tap = 0; Tap < NumTapsY; Tap++)
+		{
+			const float Weight = WeightsY[Y * NumTapsY + Tap];
+			const float* SourceRow = RowsResampled.GetData() + IndicesY[Y * NumTapsY + Tap] * NewWidth;
+			for (int32 X = 0; X < NewWidth; X++)
+				Accumulator[X] += Weight * SourceRow[X];
+		}
+
+		// Clamp the values, as the filters can overshoot
+		T* DestRow = Result.GetData() + Y * NewWidth;
+		for (int32 X = 0; X < NewWidth; X++)
+			DestRow[X] = (T)FMath::RoundToInt(FMath::Clamp(Accumulator[X], 0.0f, MaxValue));
+	});
+
 	return Result;
 }
 
@@ -2030,27 +2580,76 @@ FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPar
 	
 	const int32 SizeInPoints = VolumeInfo.xLength *  VolumeInfo.yLength;
 
-	OutFloatArr.SetNum(SizeInPoints);
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetHeightFieldData(
-		FHoudiniEngine::Get().GetSession(),
-		HGPO->GeoId, HGPO->PartId,
-		OutFloatArr.GetData(),
-		0, SizeInPoints), false);
-	
-	OutFloatMin = OutFloatArr[0];
-	OutFloatMax = OutFloatMin;
+	OutFloatArr.SetNumUninitialized(SizeInPoints);
+
+	// Fetch the heightfield's values in chunks, so the min/max of a chunk can be
+	// calculated in the background while the next one is being transferred.
+	const int32 ChunkSize = HAPI_UNREAL_HEIGHTFIELD_FETCH_CHUNK_SIZE;
+	const int32 NumChunks = FMath::DivideAndRoundUp(SizeInPoints, ChunkSize);
+
+	TArray<TFuture<FFloatRange>> ChunkRanges;
+	ChunkRanges.Reserve(NumChunks);
 
-	for (float NextFloatVal : OutFloatArr) 
+	bool bSuccess = true;
+	for (int32 ChunkIdx = 0; ChunkIdx < NumChunks; ChunkIdx++)
 	{
-		if (NextFloatVal > OutFloatMax)
+		const int32 Start = ChunkIdx * ChunkSize;
+		const int32 Length = FMath::Min(ChunkSize, SizeInPoints - Start);
+		float* ChunkData = OutFloatArr.GetData() + Start;
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetHeightFieldData(
+			FHoudiniEngine::Get().GetSession(),
+			HGPO->GeoId, HGPO->PartId,
+			ChunkData, Start, Length))
 		{
-			OutFloatMax = NextFloatVal;
+			HOUDINI_LOG_ERROR(TEXT("Hapi failed: %s"), *FHoudiniEngineUtils::GetErrorDescription());
+			bSuccess = false;
+			break;
 		}
-		else if (NextFloatVal < OutFloatMin)
-			OutFloatMin = NextFloatVal;
+
+		ChunkRanges.Add(Async(EAsyncExecution::ThreadPool, [ChunkData, Length]()
+		{
+			float ChunkMin = ChunkData[0];
+			float ChunkMax = ChunkMin;
+			for (int32 Idx = 1; Idx < Length; Idx++)
+			{
+				const float NextFloatVal = ChunkData[Idx];
+				if (NextFloatVal > ChunkMax)
+					ChunkMax = NextFloatVal;
+				else if (NextFloatVal < ChunkMin)
+					ChunkMin = NextFloatVal;
+			}
+
+			return FFloatRange::Inclusive(ChunkMin, ChunkMax);
+		}));
 	}
 
-	return true;
+	// Reduce the min/max of all the chunks
+	// (always wait for all the pending chunks, as they read the output array)
+	for (int32 ChunkIdx = 0; ChunkIdx < ChunkRanges.Num(); ChunkIdx++)
+	{
+		const FFloatRange ChunkRange = ChunkRanges[ChunkIdx].Get();
+		const float ChunkMin = ChunkRange.GetLowerBoundValue();
+		const float ChunkMax = ChunkRange.GetUpperBoundValue();
+		if (ChunkIdx == 0)
+		{
+			OutFloatMin = ChunkMin;
+			OutFloatMax = ChunkMax;
+			continue;
+		}
+
+		OutFloatMin = FMath::Min(OutFloatMin, ChunkMin);
+		OutFloatMax = FMath::Max(OutFloatMax, ChunkMax);
+	}
+
+	if (!bSuccess)
+	{
+		OutFloatArr.Empty();
+		OutFloatMin = 0.f;
+		OutFloatMax = 0.f;
+	}
+
+	return bSuccess;
 }
 
 bool
@@ -2124,7 +2723,8 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 	bool bIsUpdate,
 	const FHoudiniPackageParams& InTilePackageParams,
 	const FHoudiniPackageParams& InLayerPackageParams, 
-	TArray<UPackage*>& OutCreatedPackages
+	TArray<UPackage*>& OutCreatedPackages,
+	TArray<FHoudiniLandscapeLayerTileData>* InPreparedLayers
 	)
 {
 	OutLayerInfos.Empty();
@@ -2160,15 +2760,36 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 			continue;
 		}
 
+		// See if this layer's data has already been fetched and converted
+		FHoudiniLandscapeLayerTileData* PreparedLayer = nullptr;
+		if (InPreparedLayers && InPreparedLayers->IsValidIndex(IterLayers.GetIndex()))
+		{
+			PreparedLayer = &(*InPreparedLayers)[IterLayers.GetIndex()];
+			if (PreparedLayer->LayerGeoPartObject != LayerGeoPartObject)
+				PreparedLayer = nullptr;
+		}
+
 		TArray<float> FloatLayerData;
 		float LayerMin = 0;
 		float LayerMax = 0;
-		if (!FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(LayerGeoPartObject, FloatLayerData, LayerMin, LayerMax))
-			continue;
+		if (PreparedLayer)
+		{
+			// Flat or invalid layers have already been skipped
+			if (PreparedLayer->bSkipLayer)
+				continue;
 
-		// No need to create flat layers as Unreal will remove them afterwards..
-		if (LayerMin == LayerMax)
-			continue;
+			LayerMin = PreparedLayer->LayerMin;
+			LayerMax = PreparedLayer->LayerMax;
+		}
+		else
+		{
+			if (!FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(LayerGeoPartObject, FloatLayerData, LayerMin, LayerMax))
+				continue;
+
+			// No need to create flat layers as Unreal will remove them afterwards..
+			if (LayerMin == LayerMax)
+				continue;
+		}
 
 		const FHoudiniVolumeInfo& LayerVolumeInfo = LayerGeoPartObject->VolumeInfo;
 
@@ -2179,7 +2800,7 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 		TilePackageParams.ObjectName = InTilePackageParams.ObjectName + TEXT("_layer_") + SanitizedLayerName;
 		LayerPackageParams.ObjectName = InLayerPackageParams.ObjectName + TEXT("_layer_") + SanitizedLayerName;
 
-		if (bExportTexture)
+		if (bExportTexture && FloatLayerData.Num() > 0)
 		{
 			// Create a raw texture export of the layer on this tile
 			FString TextureName = TilePackageParams.ObjectName + "_raw";
@@ -2194,7 +2815,11 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 		}
 
 		// Check if that landscape layer has been marked as unit (range in [0-1]
-		if (IsUnitLandscapeLayer(*LayerGeoPartObject))
+		if (PreparedLayer)
+		{
+			// The prepared min/max already account for this
+		}
+		else if (IsUnitLandscapeLayer(*LayerGeoPartObject))
 		{
 			LayerMin = 0.0f;
 			LayerMax = 1.0f;
@@ -2235,12 +2860,22 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 
 		// Convert the float data to uint8
 		// HF masks need their X/Y sizes swapped
-		if (!FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
+		if (PreparedLayer)
+		{
+			// Wait for the layer's conversion
+			if (!PreparedLayer->ConversionResult.IsValid() || !PreparedLayer->ConversionResult.Get())
+				continue;
+
+			ImportLayerInfo.LayerData = MoveTemp(PreparedLayer->LayerData);
+		}
+		else if (!FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
 			FloatLayerData, LayerVolumeInfo.YLength, LayerVolumeInfo.XLength,
 			LayerMin, LayerMax,
 			LandscapeXSize, LandscapeYSize,
 			ImportLayerInfo.LayerData))
+		{
 			continue;
+		}
 		
 		// We will store the data used to convert from Houdini values to int in the DebugColor
 		// This is the only way we'll be able to reconvert those values back to their houdini equivalent afterwards...
@@ -2529,28 +3164,28 @@ FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
 {
 	// Convert the float data to uint8
 	LayerData.SetNumUninitialized(HoudiniXSize * HoudiniYSize);
+	if (FloatLayerData.Num() < LayerData.Num())
+		return false;
 
 	// Calculating the factor used to convert from Houdini's ZRange to [0 255]
 	double LayerZRange = (LayerMax - LayerMin);
 	double LayerZSpacing = (LayerZRange != 0.0) ? (255.0 / (double)(LayerZRange)) : 0.0;
 
-	int32 nUnrealIndex = 0;
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
+	// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
+	const float ClampMin = LayerMin;
+	const float ClampMax = LayerMax;
+	FHoudiniEngineUtils::TransposeAndConvertData(
+		FloatLayerData.GetData(), LayerData.GetData(), HoudiniXSize, HoudiniYSize,
+		[ClampMin, ClampMax, LayerZSpacing](const float& FloatValue)
 		{
-			// Copying values X then Y in Unreal but reading them Y then X in Houdini due to swapped X/Y
-			int32 nHoudini = nY + nX * HoudiniYSize;
-
 			// Get the double values in [0 - ZRange]
-			double DoubleValue = (double)FMath::Clamp(FloatLayerData[nHoudini], LayerMin, LayerMax) - (double)LayerMin;
+			double DoubleValue = (double)FMath::Clamp(FloatValue, ClampMin, ClampMax) - (double)ClampMin;
 
 			// Then convert it to [0 - 255]
 			DoubleValue *= LayerZSpacing;
 
-			LayerData[nUnrealIndex++] = FMath::RoundToInt(DoubleValue);
-		}
-	}
+			return (uint8)FMath::RoundToInt(DoubleValue);
+		});
 
 	// Finally, resize the data to fit with the new landscape size if needed
 	if (NoResize)
@@ -3227,7 +3862,7 @@ FHoudiniLandscapeTranslator::UpdateGenericPropertiesAttributes(
 
 
 bool
-FHoudiniLandscapeTranslator::BackupLandscapeToImageFiles(const FString& BaseName, ALandscapeProxy* Landscape)
+FHoudiniLandscapeTranslator::BackupLandscapeToCacheFile(const FString& BaseName, ALandscapeProxy* Landscape, FString& OutCacheFile)
 {
 	// We need to cache the input landscape to a file    
 	if (!Landscape)
@@ -3237,34 +3872,75 @@ FHoudiniLandscapeTranslator::BackupLandscapeToImageFiles(const FString& BaseName
 	if (!LandscapeInfo)
 		return false;
 
-	// Save Height data to file
-	//FString HeightSave = TEXT("/Game/HoudiniEngine/Temp/HeightCache.png");    
-	FString HeightSave = BaseName + TEXT("_height.png");
-	LandscapeInfo->ExportHeightmap(HeightSave);
-	Landscape->ReimportHeightmapFilePath = HeightSave;
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY))
+		return false;
+
+	const int32 SizeX = MaxX - MinX + 1;
+	const int32 SizeY = MaxY - MinY + 1;
+	int32 RowsPerBand = FMath::Max(1, LandscapeInfo->ComponentSizeQuads);
+	const bool bCompress = CVarHoudiniEngineCompressLandscapeBackups.GetValueOnAnyThread() == 1;
 
-	// Save each layer to a file
+	// Gather the layers to save
+	TArray<ULandscapeLayerInfoObject*> LayerInfos;
 	for (int LayerIndex = 0; LayerIndex < LandscapeInfo->Layers.Num(); LayerIndex++)
 	{
-		FName CurrentLayerName = LandscapeInfo->Layers[LayerIndex].GetLayerName();
-		//ULandscapeLayerInfoObject* CurrentLayerInfo = LandscapeInfo->GetLayerInfoByName(CurrentLayerName, Landscape);
 		ULandscapeLayerInfoObject* CurrentLayerInfo = LandscapeInfo->Layers[LayerIndex].LayerInfoObj;
 		if (!CurrentLayerInfo || CurrentLayerInfo->IsPendingKill())
 			continue;
 
-		FString LayerSave = BaseName + CurrentLayerName.ToString() + TEXT(".png");
-		LandscapeInfo->ExportLayer(CurrentLayerInfo, LayerSave);
+		LayerInfos.Add(CurrentLayerInfo);
+	}
+
+	TArray<uint8> FileData;
+	FMemoryWriter Ar(FileData);
+
+	uint32 Magic = HoudiniLandscapeCacheMagic;
+	int32 Version = HoudiniLandscapeCacheVersion;
+	int32 NumLayers = LayerInfos.Num();
+	Ar << Magic;
+	Ar << Version;
+	Ar << MinX << MinY << MaxX << MaxY;
+	Ar << RowsPerBand;
+	Ar << NumLayers;
 
-		// Update the file reimport path on the input landscape for this layer
-		LandscapeInfo->GetLayerEditorSettings(CurrentLayerInfo).ReimportLayerFilePath = LayerSave;
+	// Save the height data, the data is extracted on the game thread but compressed in parallel
+	FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+	{
+		TArray<uint16> HeightData;
+		HeightData.SetNumZeroed(SizeX * SizeY);
+		LandscapeEdit.GetHeightDataFast(MinX, MinY, MaxX, MaxY, HeightData.GetData(), 0);
+		WriteLandscapeCacheData(Ar, HeightData, SizeX, SizeY, RowsPerBand, bCompress);
+	}
+
+	// Save each layer
+	TArray<uint8> LayerData;
+	for (ULandscapeLayerInfoObject* CurrentLayerInfo : LayerInfos)
+	{
+		FString LayerName = CurrentLayerInfo->LayerName.ToString();
+		Ar << LayerName;
+
+		LayerData.SetNumZeroed(SizeX * SizeY);
+		LandscapeEdit.GetWeightDataFast(CurrentLayerInfo, MinX, MinY, MaxX, MaxY, LayerData.GetData(), 0);
+		WriteLandscapeCacheData(Ar, LayerData, SizeX, SizeY, RowsPerBand, bCompress);
+	}
+
+	const FString CacheFile = BaseName + HoudiniLandscapeCacheExtension;
+	if (!FFileHelper::SaveArrayToFile(FileData, *CacheFile))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not save the landscape backup file %s."), *CacheFile);
+		return false;
 	}
 
+	// Leave the landscape's own reimport paths untouched, the caller keeps track of the backup file
+	OutCacheFile = CacheFile;
+
 	return true;
 }
 
 
 bool
-FHoudiniLandscapeTranslator::RestoreLandscapeFromImageFiles(ALandscapeProxy* LandscapeProxy)
+FHoudiniLandscapeTranslator::RestoreLandscapeFromCacheFile(ALandscapeProxy* LandscapeProxy, const FString& InCacheFile)
 {
 	if (!LandscapeProxy)
 		return false;
@@ -3273,9 +3949,68 @@ FHoudiniLandscapeTranslator::RestoreLandscapeFromImageFiles(ALandscapeProxy* Lan
 	if (!LandscapeInfo)
 		return false;
 
-	// Restore Height data from the backup file
-	FString ReimportFile = LandscapeProxy->ReimportHeightmapFilePath;
-	if (!FHoudiniLandscapeTranslator::ImportLandscapeData(LandscapeInfo, ReimportFile, TEXT("height")))
+	// Read the cache file, if the backup uses one.
+	// Backups made by previous versions used one image file for the height and for each layer,
+	// and stored them in the landscape's reimport paths.
+	const bool bUseCacheFile = !InCacheFile.IsEmpty();
+	FString ReimportFile = bUseCacheFile ? InCacheFile : LandscapeProxy->ReimportHeightmapFilePath;
+	TMap<FString, TArray<uint8>> CachedLayersData;
+	bool bCacheFileRead = false;
+	int32 MinX = 0, MinY = 0, MaxX = 0, MaxY = 0;
+	if (bUseCacheFile && LandscapeInfo->GetLandscapeExtent(MinX, MinY, MaxX, MaxY))
+	{
+		TArray<uint8> FileData;
+		if (FFileHelper::LoadFileToArray(FileData, *ReimportFile))
+		{
+			FMemoryReader Ar(FileData);
+
+			uint32 Magic = 0;
+			int32 Version = 0;
+			int32 CachedMinX = 0, CachedMinY = 0, CachedMaxX = 0, CachedMaxY = 0;
+			int32 RowsPerBand = 0;
+			int32 NumLayers = 0;
+			Ar << Magic;
+			Ar << Version;
+			Ar << CachedMinX << CachedMinY << CachedMaxX << CachedMaxY;
+			Ar << RowsPerBand;
+			Ar << NumLayers;
+
+			// The landscape's extent must not have changed since the backup
+			const int32 SizeX = MaxX - MinX + 1;
+			const int32 SizeY = MaxY - MinY + 1;
+			TArray<uint16> HeightData;
+			bCacheFileRead = !Ar.IsError()
+				&& Magic == HoudiniLandscapeCacheMagic
+				&& Version == HoudiniLandscapeCacheVersion
+				&& CachedMinX == MinX && CachedMinY == MinY && CachedMaxX == MaxX && CachedMaxY == MaxY
+				&& RowsPerBand > 0 && NumLayers >= 0
+				&& ReadLandscapeCacheData(Ar, FileData, HeightData, SizeX, SizeY, RowsPerBand);
+
+			for (int32 LayerIndex = 0; bCacheFileRead && LayerIndex < NumLayers; LayerIndex++)
+			{
+				FString LayerName;
+				Ar << LayerName;
+				bCacheFileRead = !Ar.IsError()
+					&& ReadLandscapeCacheData(Ar, FileData, CachedLayersData.FindOrAdd(LayerName), SizeX, SizeY, RowsPerBand);
+			}
+
+			// Restore Height data from the backup file
+			if (bCacheFileRead)
+			{
+				FHeightmapAccessor<false> HeightmapAccessor(LandscapeInfo);
+				HeightmapAccessor.SetData(MinX, MinY, MaxX, MaxY, HeightData.GetData());
+			}
+		}
+	}
+
+	if (bUseCacheFile && !bCacheFileRead)
+	{
+		HOUDINI_LOG_ERROR(TEXT("Could not restore the landscape actor's source data, the backup file %s is invalid."), *ReimportFile);
+		return false;
+	}
+
+	// Restore Height data from the backup image file
+	if (!bUseCacheFile && !FHoudiniLandscapeTranslator::ImportLandscapeData(LandscapeInfo, ReimportFile, TEXT("height")))
 		HOUDINI_LOG_ERROR(TEXT("Could not restore the landscape actor's source height data."));
 
 	// Restore each layer from the backup file
@@ -3289,8 +4024,23 @@ FHoudiniLandscapeTranslator::RestoreLandscapeFromImageFiles(ALandscapeProxy* Lan
 		FString CurrentLayerName = CurrentLayerInfo->LayerName.ToString();
 		ReimportFile = LandscapeProxy->EditorLayerSettings[LayerIndex].ReimportLayerFilePath;
 
-		if (!FHoudiniLandscapeTranslator::ImportLandscapeData(LandscapeInfo, ReimportFile, CurrentLayerName, CurrentLayerInfo))
+		if (bUseCacheFile)
+		{
+			TArray<uint8>* CachedLayerData = CachedLayersData.Find(CurrentLayerName);
+			if (CachedLayerData)
+			{
+				FAlphamapAccessor<false, false> AlphamapAccessor(LandscapeInfo, CurrentLayerInfo);
+				AlphamapAccessor.SetData(MinX, MinY, MaxX, MaxY, CachedLayerData->GetData(), ELandscapeLayerPaintingRestriction::None);
+			}
+			else
+			{
+				HOUDINI_LOG_ERROR(TEXT("Could not restore the landscape actor's source data for layer %s."), *CurrentLayerName);
+			}
+		}
+		else if (!FHoudiniLandscapeTranslator::ImportLandscapeData(LandscapeInfo, ReimportFile, CurrentLayerName, CurrentLayerInfo))
+		{
 			HOUDINI_LOG_ERROR(TEXT("Could not restore the landscape actor's source height data."));
+		}
 
 		SourceLayers.Add(CurrentLayerInfo);
 	}
@@ -35,11 +35,60 @@
 #include "HoudiniEngineOutputStats.h"
 #include "HoudiniPackageParams.h"
 
+#include "Async/Future.h"
+
 class UHoudiniAssetComponent;
 class ULandscapeLayerInfoObject;
 struct FHoudiniGenericAttribute;
 struct FHoudiniPackageParams;
 
+// A landscape layer's data, fetched from Houdini and converted ahead of the landscape's creation
+struct FHoudiniLandscapeLayerTileData
+{
+	~FHoudiniLandscapeLayerTileData()
+	{
+		// The conversion writes to LayerData, wait for it to finish
+		if (ConversionResult.IsValid())
+			ConversionResult.Wait();
+	}
+
+	const FHoudiniGeoPartObject* LayerGeoPartObject = nullptr;
+
+	// The layer's data couldn't be fetched, or is flat and should not be created
+	bool bSkipLayer = true;
+
+	// Min/max values used for the conversion
+	float LayerMin = 0.0f;
+	float LayerMax = 0.0f;
+
+	TArray<uint8> LayerData;
+	TFuture<bool> ConversionResult;
+};
+
+// A landscape tile's height and layer data, fetched from Houdini and converted ahead of the landscape's creation
+struct FHoudiniLandscapeTileData
+{
+	~FHoudiniLandscapeTileData()
+	{
+		// The conversion writes to IntHeightData and TileTransform, wait for it to finish
+		if (ConversionResult.IsValid())
+			ConversionResult.Wait();
+	}
+
+	const FHoudiniGeoPartObject* Heightfield = nullptr;
+
+	int32 UnrealTileSizeX = -1;
+	int32 UnrealTileSizeY = -1;
+
+	TArray<uint16> IntHeightData;
+	FTransform TileTransform;
+	TFuture<bool> ConversionResult;
+
+	// Layers, in the same order as returned by GetHeightfieldsLayersFromOutput
+	TArray<const FHoudiniGeoPartObject*> FoundLayers;
+	TArray<FHoudiniLandscapeLayerTileData> Layers;
+};
+
 struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 {
 	public:
@@ -60,7 +109,20 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			const TMap<FString, float>& LayerMinimums,
 			const TMap<FString, float>& LayerMaximums,
 			FHoudiniPackageParams InPackageParams,
-			TArray<UPackage*>& OutCreatedPackages);
+			TArray<UPackage*>& OutCreatedPackages,
+			FHoudiniLandscapeTileData* InTileData = nullptr);
+
+		// Fetches the heightfield data of the landscape outputs, starting at InOutNextOutputIdx, and converts it on the thread pool.
+		// HAPI calls are made sequentially on the calling thread, while the conversion of the previous tiles is running.
+		// Stops once InOutTilesData holds InMaxTilesInFlight tiles, so this should be called again once a tile has been consumed.
+		// The returned tile data can then be passed to CreateLandscape for each output.
+		static void PrepareLandscapeTilesData(
+			const TArray<UHoudiniOutput*>& InOutputs,
+			const TMap<FString, float>& LayerMinimums,
+			const TMap<FString, float>& LayerMaximums,
+			const int32& InMaxTilesInFlight,
+			int32& InOutNextOutputIdx,
+			TMap<UHoudiniOutput*, TUniquePtr<FHoudiniLandscapeTileData>>& InOutTilesData);
 
 		static ALandscapeProxy* FindExistingLandscapeActor_Bake(
 			UWorld* InWorld,
@@ -238,7 +300,8 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			bool bIsUpdate,
 			const FHoudiniPackageParams& InTilePackageParams,
 			const FHoudiniPackageParams& InLayerPackageParams,
-			TArray<UPackage*>& OutCreatedPackages);
+			TArray<UPackage*>& OutCreatedPackages,
+			TArray<FHoudiniLandscapeLayerTileData>* InPreparedLayers = nullptr);
 
 		static bool GetNonWeightBlendedLayerNames(
 			const FHoudiniGeoPartObject& HeightfieldGeoPartObject,
@@ -366,10 +429,13 @@ public:
 			UObject* InObject,
 			const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes);
 
-		static bool BackupLandscapeToImageFiles(
-			const FString& BaseName, ALandscapeProxy* Landscape);
+		// Backs up the landscape's height and layers data to a binary cache file (BaseName.hlcache)
+		static bool BackupLandscapeToCacheFile(
+			const FString& BaseName, ALandscapeProxy* Landscape, FString& OutCacheFile);
 
-		static bool RestoreLandscapeFromImageFiles(ALandscapeProxy* LandscapeProxy);
+		// Restores the landscape's data from its backup cache file.
+		// If no cache file is given, uses the image files (set as the landscape's reimport paths) of older backups.
+		static bool RestoreLandscapeFromCacheFile(ALandscapeProxy* LandscapeProxy, const FString& InCacheFile);
 
 		static UPhysicalMaterial* GetLandscapePhysicalMaterial(const FHoudiniGeoPartObject& InLayerHGPO);
 
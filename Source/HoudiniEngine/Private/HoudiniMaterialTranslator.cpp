@@ -53,6 +53,7 @@
 #include "PackageTools.h"
 #include "AssetRegistryModule.h"
 #include "UObject/MetaData.h"
+#include "Hash/CityHash.h"
 
 #if WITH_EDITOR
 	#include "Factories/MaterialFactoryNew.h"
@@ -259,6 +260,119 @@ bool FHoudiniMaterialTranslator::CreateHoudiniMaterials(
 	return true;
 }
 
+// A material instance shared by the parts requesting the same parent material and parameter values
+struct FHoudiniSharedMaterialInstance
+{
+	TWeakObjectPtr<UMaterialInstanceConstant> MaterialInstance;
+	// Parts currently using the material instance
+	TSet<FString> Owners;
+};
+
+// Material instances created during this session, keyed by their package path and parameter signature
+static TMap<FString, FHoudiniSharedMaterialInstance> MaterialInstanceSignatureCache;
+// Signature key of each cached material instance
+static TMap<TWeakObjectPtr<UMaterialInstanceConstant>, FString> MaterialInstanceSignatureKeys;
+// Signature key of the material instance used by each part
+static TMap<FString, FString> MaterialInstanceOwnerSignatureKeys;
+
+// Stops a part from using its cached material instance, the instance is forgotten once no part uses it
+static void
+ReleaseMaterialInstanceOwner(const FString& InOwnerKey)
+{
+	FString SignatureKey;
+	if (!MaterialInstanceOwnerSignatureKeys.RemoveAndCopyValue(InOwnerKey, SignatureKey))
+		return;
+
+	FHoudiniSharedMaterialInstance* SharedInstance = MaterialInstanceSignatureCache.Find(SignatureKey);
+	if (!SharedInstance)
+		return;
+
+	SharedInstance->Owners.Remove(InOwnerKey);
+	if (SharedInstance->Owners.Num() > 0)
+		return;
+
+	const FString* InstanceSignatureKey = MaterialInstanceSignatureKeys.Find(SharedInstance->MaterialInstance);
+	if (InstanceSignatureKey && *InstanceSignatureKey == SignatureKey)
+		MaterialInstanceSignatureKeys.Remove(SharedInstance->MaterialInstance);
+
+	MaterialInstanceSignatureCache.Remove(SignatureKey);
+}
+
+// Registers a part as a user of the material instance cached for a signature
+static void
+AddMaterialInstanceOwner(const FString& InOwnerKey, const FString& InSignatureKey, UMaterialInstanceConstant* InMaterialInstance)
+{
+	FHoudiniSharedMaterialInstance& SharedInstance = MaterialInstanceSignatureCache.FindOrAdd(InSignatureKey);
+	if (SharedInstance.MaterialInstance.Get() != InMaterialInstance)
+	{
+		const FString* InstanceSignatureKey = MaterialInstanceSignatureKeys.Find(SharedInstance.MaterialInstance);
+		if (InstanceSignatureKey && *InstanceSignatureKey == InSignatureKey)
+			MaterialInstanceSignatureKeys.Remove(SharedInstance.MaterialInstance);
+
+		SharedInstance.MaterialInstance = InMaterialInstance;
+	}
+
+	SharedInstance.Owners.Add(InOwnerKey);
+	MaterialInstanceSignatureKeys.Add(SharedInstance.MaterialInstance, InSignatureKey);
+	MaterialInstanceOwnerSignatureKeys.Add(InOwnerKey, InSignatureKey);
+}
+
+void
+FHoudiniMaterialTranslator::ReleaseMaterialInstances(const FGuid& InComponentGUID)
+{
+	const FString OwnerKeyPrefix = InComponentGUID.ToString() + TEXT("/");
+
+	TArray<FString> OwnerKeys;
+	for (const auto& CurrentPair : MaterialInstanceOwnerSignatureKeys)
+	{
+		if (CurrentPair.Key.StartsWith(OwnerKeyPrefix))
+			OwnerKeys.Add(CurrentPair.Key);
+	}
+
+	for (const FString& OwnerKey : OwnerKeys)
+		ReleaseMaterialInstanceOwner(OwnerKey);
+}
+
+void
+FHoudiniMaterialTranslator::ClearMaterialInstanceCache()
+{
+	MaterialInstanceSignatureCache.Empty();
+	MaterialInstanceSignatureKeys.Empty();
+	MaterialInstanceOwnerSignatureKeys.Empty();
+}
+
+// Returns a hash of the parent material and of all the parameter values overridden by a material instance.
+// Parameters are sorted by name so the signature doesn't depend on the attribute order.
+static FString
+GetMaterialInstanceSignature(const UMaterialInterface* InParentMaterial, const TArray<FHoudiniGenericAttribute>& InMaterialParameters)
+{
+	TArray<const FHoudiniGenericAttribute*> SortedParameters;
+	for (const FHoudiniGenericAttribute& CurrentParameter : InMaterialParameters)
+		SortedParameters.Add(&CurrentParameter);
+
+	SortedParameters.StableSort([](const FHoudiniGenericAttribute& A, const FHoudiniGenericAttribute& B)
+	{
+		return A.AttributeName < B.AttributeName;
+	});
+
+	const FString ParentPath = InParentMaterial ? InParentMaterial->GetPathName() : FString();
+	uint64 Hash = CityHash64((const char*)*ParentPath, ParentPath.Len() * sizeof(TCHAR));
+	for (const FHoudiniGenericAttribute* CurrentParameter : SortedParameters)
+	{
+		const FString& Name = CurrentParameter->AttributeName;
+		Hash = CityHash64WithSeed((const char*)*Name, Name.Len() * sizeof(TCHAR), Hash);
+
+		const int32 ParameterType[2] = { (int32)CurrentParameter->AttributeType, CurrentParameter->AttributeTupleSize };
+		Hash = CityHash64WithSeed((const char*)ParameterType, sizeof(ParameterType), Hash);
+		Hash = CityHash64WithSeed((const char*)CurrentParameter->DoubleValues.GetData(), CurrentParameter->DoubleValues.Num() * sizeof(double), Hash);
+		Hash = CityHash64WithSeed((const char*)CurrentParameter->IntValues.GetData(), CurrentParameter->IntValues.Num() * sizeof(int64), Hash);
+		for (const FString& CurrentString : CurrentParameter->StringValues)
+			Hash = CityHash64WithSeed((const char*)*CurrentString, CurrentString.Len() * sizeof(TCHAR), Hash);
+	}
+
+	return FString::Printf(TEXT("%016llx"), Hash);
+}
+
 //
 bool
 FHoudiniMaterialTranslator::CreateMaterialInstances(
@@ -294,7 +408,7 @@ FHoudiniMaterialTranslator::CreateMaterialInstances(
 
 		// Try to find the material we want to create an instance of
 		UMaterialInterface* CurrentSourceMaterialInterface = Cast<UMaterialInterface>(
-			StaticLoadObject(UMaterialInterface::StaticClass(), nullptr, *CurrentSourceMaterial, nullptr, LOAD_NoWarn, nullptr));
+			FHoudiniEngineUtils::LoadObjectFromPathCached(CurrentSourceMaterial, UMaterialInterface::StaticClass()));
 		
 		if (!CurrentSourceMaterialInterface || CurrentSourceMaterialInterface->IsPendingKill())
 		{
@@ -311,13 +425,62 @@ FHoudiniMaterialTranslator::CreateMaterialInstances(
 		// Increase the material index
 		MaterialIndex++;
 
+		// See if we need to override some of the material instance's parameters
+		TArray<FHoudiniGenericAttribute> AllMatParams;
+		// Get the detail material parameters
+		int32 ParamCount = FHoudiniEngineUtils::GetGenericAttributeList(
+			InHGPO.GeoId, InHGPO.PartId, HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX, 
+			AllMatParams, HAPI_ATTROWNER_DETAIL, -1);
+
+		// Then the primitive material parameters
+		int32 MaterialIndexToAttributeIndex = Iter->Value;
+		ParamCount += FHoudiniEngineUtils::GetGenericAttributeList(
+			InHGPO.GeoId, InHGPO.PartId, HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX,
+			AllMatParams, HAPI_ATTROWNER_PRIM, MaterialIndexToAttributeIndex);
+
+		// Parts/splits of this component requesting an instance of the same material
+		// with the same parameter values share a single material instance
+		const FString SignatureKey = InPackageParams.GetPackagePath() + TEXT("/")
+			+ GetMaterialInstanceSignature(CurrentSourceMaterialInterface, AllMatParams);
+
+		// Identifies this part's use of the material instance
+		const FString OwnerKey = FString::Printf(TEXT("%s/%d/%d/%d/%s"),
+			*InPackageParams.ComponentGUID.ToString(), InHGPO.ObjectId, InHGPO.GeoId, InHGPO.PartId, *CurrentSourceMaterial);
+
+		// If this part's parameter values have changed, it no longer uses the instance of its previous values
+		const FString* PreviousSignatureKey = MaterialInstanceOwnerSignatureKeys.Find(OwnerKey);
+		if (PreviousSignatureKey && *PreviousSignatureKey != SignatureKey)
+			ReleaseMaterialInstanceOwner(OwnerKey);
+
+		if (!bForceRecookAll)
+		{
+			FHoudiniSharedMaterialInstance* SharedInstance = MaterialInstanceSignatureCache.Find(SignatureKey);
+			UMaterialInstanceConstant* CachedInstance = SharedInstance ? SharedInstance->MaterialInstance.Get() : nullptr;
+			if (CachedInstance && !CachedInstance->IsPendingKill() && CachedInstance->Parent == CurrentSourceMaterialInterface)
+			{
+				AddMaterialInstanceOwner(OwnerKey, SignatureKey, CachedInstance);
+				OutMaterials.Add(CurrentSourceMaterial, CachedInstance);
+				continue;
+			}
+		}
+
 		// See if we can find an existing package for that instance
 		UPackage * MaterialInstancePackage = nullptr;
+		bool bFoundSharedMaterialInstance = false;
 		UMaterialInterface * const * FoundMatPtr = InMaterials.Find(MaterialInstanceNamePrefix);
 		if (FoundMatPtr && *FoundMatPtr)
 		{
 			// We found an already existing MI, get its package
 			MaterialInstancePackage = Cast<UPackage>((*FoundMatPtr)->GetOuter());
+
+			// If that MI is still used by other parts for a different signature, don't modify it
+			// and create a new instance in a new package instead. Otherwise, it is updated in place.
+			const FString* UsedSignatureKey = MaterialInstanceSignatureKeys.Find(Cast<UMaterialInstanceConstant>(*FoundMatPtr));
+			if (UsedSignatureKey && *UsedSignatureKey != SignatureKey)
+			{
+				MaterialInstancePackage = nullptr;
+				bFoundSharedMaterialInstance = true;
+			}
 		}
 
 		if (MaterialInstancePackage)
@@ -326,8 +489,11 @@ FHoudiniMaterialTranslator::CreateMaterialInstances(
 		}
 		else
 		{
-			// We couldnt find the corresponding M_I package, so create a new one
-			MaterialInstancePackage = CreatePackageForMaterial(InHGPO.AssetId, MaterialInstanceNamePrefix, InPackageParams, MaterialInstanceName);
+			// We couldnt find the corresponding M_I package (or can't reuse it), so create a new one
+			FHoudiniPackageParams MaterialInstancePackageParams = InPackageParams;
+			if (bFoundSharedMaterialInstance)
+				MaterialInstancePackageParams.ReplaceMode = EPackageReplaceMode::CreateNewAssets;
+			MaterialInstancePackage = CreatePackageForMaterial(InHGPO.AssetId, MaterialInstanceNamePrefix, MaterialInstancePackageParams, MaterialInstanceName);
 		}
 
 		// Couldn't create a package for that Material Instance
@@ -366,19 +532,6 @@ FHoudiniMaterialTranslator::CreateMaterialInstances(
 		FMaterialUpdateContext MaterialUpdateContext;
 
 		bool bModifiedMaterialParameters = false;
-		// See if we need to override some of the material instance's parameters
-		TArray<FHoudiniGenericAttribute> AllMatParams;
-		// Get the detail material parameters
-		int32 ParamCount = FHoudiniEngineUtils::GetGenericAttributeList(
-			InHGPO.GeoId, InHGPO.PartId, HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX, 
-			AllMatParams, HAPI_ATTROWNER_DETAIL, -1);
-
-		// Then the primitive material parameters
-		int32 MaterialIndexToAttributeIndex = Iter->Value;
-		ParamCount += FHoudiniEngineUtils::GetGenericAttributeList(
-			InHGPO.GeoId, InHGPO.PartId, HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX,
-			AllMatParams, HAPI_ATTROWNER_PRIM, MaterialIndexToAttributeIndex);
-
 		for (int32 ParamIdx = 0; ParamIdx < AllMatParams.Num(); ParamIdx++)
 		{
 			// Try to update the material instance parameter corresponding to the attribute
@@ -423,6 +576,8 @@ FHoudiniMaterialTranslator::CreateMaterialInstances(
 		// Add the created material to the output assignement map
 		// Use the "source" material name as we want the instance to replace it
 		OutMaterials.Add(CurrentSourceMaterial, NewMaterialInstance);
+
+		AddMaterialInstanceOwner(OwnerKey, SignatureKey, NewMaterialInstance);
 	}
 
 	return true;
@@ -579,6 +734,25 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
 		Package, Texture, HAPI_UNREAL_PACKAGE_META_NODE_PATH, *NodePath);
 
+	// Hash the image data along with the settings used to build the texture.
+	// If they match the existing texture's, it is still up to date and doesn't need to be rebuilt/recompressed.
+	uint64 TextureSettings[6] = {
+		(uint64)ImageInfo.xRes, (uint64)ImageInfo.yRes,
+		(uint64)TextureParameters.bUseAlpha, (uint64)TextureParameters.bSRGB,
+		(uint64)TextureParameters.CompressionSettings, (uint64)TextureParameters.bDeferCompression };
+	const uint64 TextureHash = CityHash64WithSeed(
+		ImageBuffer.GetData(), ImageBuffer.Num(),
+		CityHash64((const char*)TextureSettings, sizeof(TextureSettings)));
+	const FString TextureHashString = FString::Printf(TEXT("%016llx"), TextureHash);
+
+	UMetaData* MetaData = Package->GetMetaData();
+	if (ExistingTexture && MetaData && !MetaData->IsPendingKill()
+		&& ExistingTexture->Source.IsValid()
+		&& MetaData->GetValue(ExistingTexture, HAPI_UNREAL_PACKAGE_META_TEXTURE_HASH).Equals(TextureHashString))
+	{
+		return ExistingTexture;
+	}
+
 	// Initialize texture source.
 	Texture->Source.Init(ImageInfo.xRes, ImageInfo.yRes, 1, 1, TSF_BGRA8);
 
@@ -586,50 +760,40 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	uint8 * MipData = Texture->Source.LockMip(0);
 
 	// Create base map.
-	uint8* DestPtr = nullptr;
-	uint32 SrcWidth = ImageInfo.xRes;
-	uint32 SrcHeight = ImageInfo.yRes;
-	const char * SrcData = &ImageBuffer[0];
-
-	for (uint32 y = 0; y < SrcHeight; y++)
-	{
-		DestPtr = &MipData[(SrcHeight - 1 - y) * SrcWidth * sizeof(FColor)];
-
-		for (uint32 x = 0; x < SrcWidth; x++)
+	const int32 SrcWidth = ImageInfo.xRes;
+	const int32 SrcHeight = ImageInfo.yRes;
+	const bool bBufferIsValid = ImageBuffer.Num() >= SrcWidth * SrcHeight * 4;
+	if (!bBufferIsValid)
+		HOUDINI_LOG_WARNING(TEXT("Image buffer is too small for texture %s."), *TextureName);
+
+	// Rows are flipped and converted from RGBA to BGRA in parallel.
+	// Each pixel is swizzled as a single (little endian) 32 bits word, while keeping track of the row's alpha values.
+	const uint32* SrcPixels = reinterpret_cast<const uint32*>(ImageBuffer.GetData());
+	uint32* DestPixels = reinterpret_cast<uint32*>(MipData);
+	const uint32 OpaqueMask = TextureParameters.bUseAlpha ? 0x00000000 : 0xFF000000;
+
+	TArray<bool> RowHasAlpha;
+	RowHasAlpha.Init(false, SrcHeight);
+	ParallelFor(bBufferIsValid ? SrcHeight : 0, [&](int32 y)
+	{
+		const uint32* SrcRow = SrcPixels + y * SrcWidth;
+		uint32* DestRow = DestPixels + (SrcHeight - 1 - y) * SrcWidth;
+
+		uint32 RowAlpha = 0xFF000000;
+		for (int32 x = 0; x < SrcWidth; x++)
 		{
-			uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + 2); // B
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + 1); // G
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + 0); // R
-
-			if (TextureParameters.bUseAlpha)
-				*DestPtr++ = *(uint8*)(SrcData + DataOffset + 3); // A
-			else
-				*DestPtr++ = 0xFF;
+			const uint32 Pixel = SrcRow[x];
+			RowAlpha &= Pixel;
+			DestRow[x] = (Pixel & 0xFF00FF00) | ((Pixel & 0x000000FF) << 16) | ((Pixel >> 16) & 0x000000FF) | OpaqueMask;
 		}
-	}
 
+		RowHasAlpha[y] = (RowAlpha != 0xFF000000);
+	});
+
+	// See if there is an actual alpha value in the texture or if we can ignore the texture alpha
 	bool bHasAlphaValue = false;
 	if (TextureParameters.bUseAlpha)
-	{
-		// See if there is an actual alpha value in the texture or if we can ignore the texture alpha
-		for (uint32 y = 0; y < SrcHeight; y++)
-		{
-			for (uint32 x = 0; x < SrcWidth; x++)
-			{
-				uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-				if (*(uint8*)(SrcData + DataOffset + 3) != 0xFF)
-				{
-					bHasAlphaValue = true;
-					break;
-				}
-			}
-
-			if (bHasAlphaValue)
-				break;
-		}
-	}
+		bHasAlphaValue = RowHasAlpha.Contains(true);
 
 	// Unlock the texture.
 	Texture->Source.UnlockMip(0);
@@ -650,6 +814,9 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 
 	Texture->PostEditChange();
 
+	FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+		Package, Texture, HAPI_UNREAL_PACKAGE_META_TEXTURE_HASH, TextureHashString);
+
 	return Texture;
 }
 
@@ -75,6 +75,12 @@ public:
 		TMap<FString, UMaterialInterface *>& OutMaterials,
 		const bool& bForceRecookAll);
 
+	// Forgets the material instances shared by the parts of a component, when its outputs are rebuilt or deleted
+	static void ReleaseMaterialInstances(const FGuid& InComponentGUID);
+
+	// Forgets all the shared material instances
+	static void ClearMaterialInstanceCache();
+
 	//
 	static bool UpdateMaterialInstanceParameter(
 		FHoudiniGenericAttribute MaterialParameter,
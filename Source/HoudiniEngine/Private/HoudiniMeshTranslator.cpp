@@ -2151,8 +2151,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 					{
 						// Only try to load a material if has a chance to be valid!
 						MaterialInterface = Cast<UMaterialInterface>(
-							StaticLoadObject(UMaterialInterface::StaticClass(),
-								nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
+							FHoudiniEngineUtils::LoadObjectFromPathCached(MaterialName, UMaterialInterface::StaticClass()));
 					}
 
 					if (MaterialInterface)
@@ -3161,8 +3160,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 							{
 								// Only try to load a material if has a chance to be valid!
 								MaterialInterface = Cast< UMaterialInterface >(
-									StaticLoadObject(UMaterialInterface::StaticClass(),
-										nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
+									FHoudiniEngineUtils::LoadObjectFromPathCached(MaterialName, UMaterialInterface::StaticClass()));
 							}
 
 							if (MaterialInterface)
@@ -4468,8 +4466,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 					{
 						// Only try to load a material if has a chance to be valid!
 						MaterialInterface = Cast<UMaterialInterface>(
-							StaticLoadObject(UMaterialInterface::StaticClass(),
-								nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
+							FHoudiniEngineUtils::LoadObjectFromPathCached(MaterialName, UMaterialInterface::StaticClass()));
 					}
 
 					if (MaterialInterface)
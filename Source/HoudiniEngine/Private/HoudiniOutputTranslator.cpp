@@ -214,6 +214,20 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 			InputLandscapesToUpdate.Add(InputLandscape);
 	}
 
+	// Fetch the first landscape tiles data now, so their conversion can run
+	// concurrently on the thread pool while we process the other outputs.
+	// The window is refilled every time a tile has been created.
+	const int32 MaxLandscapeTilesInFlight = 4;
+	const bool bPrepareLandscapeTiles = HAC->IsOutputTypeSupported(EHoudiniOutputType::Landscape);
+	int32 NextLandscapeTileOutputIdx = 0;
+	TMap<UHoudiniOutput*, TUniquePtr<FHoudiniLandscapeTileData>> LandscapeTilesData;
+	if (bPrepareLandscapeTiles)
+	{
+		FHoudiniLandscapeTranslator::PrepareLandscapeTilesData(
+			HAC->Outputs, LandscapeLayerGlobalMinimums, LandscapeLayerGlobalMaximums,
+			MaxLandscapeTilesInFlight, NextLandscapeTileOutputIdx, LandscapeTilesData);
+	}
+
 	// ----------------------------------------------------
 	// Process outputs
 	// ----------------------------------------------------
@@ -337,6 +351,8 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 			// make use of untracked actors on the HAC (similar to PDG Asset Link).
 			TArray<TWeakObjectPtr<AActor>> UntrackedActors;
 
+			TUniquePtr<FHoudiniLandscapeTileData>* TileData = LandscapeTilesData.Find(CurOutput);
+
 			FHoudiniLandscapeTranslator::CreateLandscape(
 				CurOutput,
 				UntrackedActors,
@@ -348,7 +364,17 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 				LandscapeLayerGlobalMinimums,
 				LandscapeLayerGlobalMaximums,
 				PackageParams,
-				CreatedPackages);
+				CreatedPackages,
+				TileData ? TileData->Get() : nullptr);
+
+			// The tile's data isn't needed anymore, start fetching the next one
+			LandscapeTilesData.Remove(CurOutput);
+			if (bPrepareLandscapeTiles)
+			{
+				FHoudiniLandscapeTranslator::PrepareLandscapeTilesData(
+					HAC->Outputs, LandscapeLayerGlobalMinimums, LandscapeLayerGlobalMaximums,
+					MaxLandscapeTilesInFlight, NextLandscapeTileOutputIdx, LandscapeTilesData);
+			}
 
 			bHasLandscape = true;
 
@@ -55,6 +55,11 @@
 #include "HoudiniEngineString.h"
 #include "HoudiniParameter.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniAsset.h"
+
+#include "Hash/CityHash.h"
+#include "Serialization/ArchiveReplaceObjectRef.h"
+#include "UObject/UObjectHash.h"
 
 
 // Default values for certain UI min and max parameter values
@@ -70,6 +75,477 @@
 #define HAPI_UNREAL_PARAM_PIVOT						"p"
 #define HAPI_UNREAL_PARAM_UNIFORMSCALE				"scale"
 
+// State of the parameter interface after the last BuildAllParameters of an object,
+// used to detect that the interface hasn't changed after a cook
+struct FHoudiniParameterInterfaceState
+{
+	// Hash of the parameter interface's structure
+	uint64 InterfaceHash = 0;
+	// Index in the ParmInfos of each of the built parameters
+	TArray<int32> ParmInfoIndices;
+	// Parameter infos and values when the parameters were last updated
+	TArray<HAPI_ParmInfo> ParmInfos;
+	FHoudiniParameterNodeValues NodeValues;
+};
+
+static TMap<TWeakObjectPtr<UObject>, FHoudiniParameterInterfaceState> ParameterInterfaceStates;
+
+// Hash the structure of a node's parameter interface: what parameters exist, their type, layout and menus.
+// Values and states that are handled by a fast update (disabled, values...) are left out.
+static uint64
+GetParameterInterfaceHash(const HAPI_NodeId& InNodeId, const HAPI_NodeInfo& InNodeInfo, const TArray<HAPI_ParmInfo>& InParmInfos)
+{
+	TArray<int32> InterfaceData;
+	InterfaceData.Reserve(InParmInfos.Num() * 10 + 1);
+	InterfaceData.Add(InParmInfos.Num());
+	for (const HAPI_ParmInfo& ParmInfo : InParmInfos)
+	{
+		InterfaceData.Add(ParmInfo.id);
+		InterfaceData.Add(ParmInfo.parentId);
+		InterfaceData.Add((int32)ParmInfo.type);
+		InterfaceData.Add((int32)ParmInfo.scriptType);
+		InterfaceData.Add(ParmInfo.size);
+		InterfaceData.Add(ParmInfo.choiceCount);
+		InterfaceData.Add(ParmInfo.instanceCount);
+		InterfaceData.Add(ParmInfo.instanceNum);
+		InterfaceData.Add(ParmInfo.tagCount);
+		// Invisible folders change which parameters are built
+		InterfaceData.Add(ParmInfo.type == HAPI_PARMTYPE_FOLDER && ParmInfo.invisible ? 1 : 0);
+	}
+
+	uint64 InterfaceHash = CityHash64((const char*)InterfaceData.GetData(), InterfaceData.Num() * InterfaceData.GetTypeSize());
+
+	// Menu contents are only read on full updates, so their labels and values are part of the interface
+	if (InNodeInfo.parmChoiceCount > 0)
+	{
+		TArray<HAPI_ParmChoiceInfo> ParmChoices;
+		ParmChoices.SetNumUninitialized(InNodeInfo.parmChoiceCount);
+		for (int32 Idx = 0; Idx < ParmChoices.Num(); Idx++)
+			FHoudiniApi::ParmChoiceInfo_Init(&(ParmChoices[Idx]));
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmChoiceLists(
+			FHoudiniEngine::Get().GetSession(), InNodeId, &ParmChoices[0], 0, InNodeInfo.parmChoiceCount))
+		{
+			// We can't tell if the menus have changed, make sure the hash won't match
+			return InterfaceHash ^ (uint64)FPlatformTime::Cycles64();
+		}
+
+		TArray<int32> ChoiceStringHandles;
+		ChoiceStringHandles.Reserve(ParmChoices.Num() * 2);
+		for (const HAPI_ParmChoiceInfo& ParmChoice : ParmChoices)
+		{
+			ChoiceStringHandles.Add(ParmChoice.labelSH);
+			ChoiceStringHandles.Add(ParmChoice.valueSH);
+		}
+
+		TArray<FString> ChoiceStrings;
+		FHoudiniEngineString::SHArrayToFStringArray(ChoiceStringHandles, ChoiceStrings);
+		for (const FString& ChoiceString : ChoiceStrings)
+			InterfaceHash = CityHash64WithSeed((const char*)*ChoiceString, ChoiceString.Len() * sizeof(TCHAR), InterfaceHash);
+	}
+
+	return InterfaceHash;
+}
+
+template<typename T>
+static bool
+AreParameterValuesEqual(const T* InParamValues, const int32& InParamCount, const TArray<T>& InNodeValues, const int32& InStart, const int32& InCount)
+{
+	if (InStart < 0 || InCount <= 0)
+		return true;
+
+	if (!InParamValues || InParamCount != InCount || InStart + InCount > InNodeValues.Num())
+		return false;
+
+	for (int32 Idx = 0; Idx < InCount; Idx++)
+	{
+		if (!(InParamValues[Idx] == InNodeValues[InStart + Idx]))
+			return false;
+	}
+
+	return true;
+}
+
+template<typename T>
+static bool
+HaveParameterValuesChanged(const TArray<T>& InOldValues, const TArray<T>& InNewValues, const int32& InStart, const int32& InCount)
+{
+	if (InStart < 0 || InCount <= 0)
+		return false;
+
+	if (InStart + InCount > InOldValues.Num() || InStart + InCount > InNewValues.Num())
+		return true;
+
+	for (int32 Idx = InStart; Idx < InStart + InCount; Idx++)
+	{
+		if (!(InOldValues[Idx] == InNewValues[Idx]))
+			return true;
+	}
+
+	return false;
+}
+
+// Indicates if a parameter needs to be updated after a cook that didn't change the parameter interface,
+// by comparing the parameter's current state and values with the node's.
+static bool
+NeedsParameterUpdate(UHoudiniParameter* InParam, const HAPI_ParmInfo& InParmInfo, const FHoudiniParameterNodeValues& InNodeValues)
+{
+	// Disable/hide when conditions
+	if (InParam->IsDisabled() != InParmInfo.disabled || InParam->IsVisible() == InParmInfo.invisible)
+		return true;
+
+	// Values modified by the cook (callbacks, expressions...)
+	switch (InParam->GetParameterType())
+	{
+		// These parameters are built from their children or their instances, always update them
+		case EHoudiniParameterType::ColorRamp:
+		case EHoudiniParameterType::FloatRamp:
+		case EHoudiniParameterType::MultiParm:
+		case EHoudiniParameterType::Folder:
+		case EHoudiniParameterType::FolderList:
+			return true;
+
+		// No values
+		case EHoudiniParameterType::Button:
+		case EHoudiniParameterType::Separator:
+		case EHoudiniParameterType::Input:
+			return false;
+
+		case EHoudiniParameterType::ButtonStrip:
+		{
+			UHoudiniParameterButtonStrip* ButtonStripParam = Cast<UHoudiniParameterButtonStrip>(InParam);
+			if (!ButtonStripParam)
+				return true;
+
+			return !AreParameterValuesEqual(ButtonStripParam->Values.GetData(), ButtonStripParam->Values.Num(),
+				InNodeValues.IntValues, InParmInfo.intValuesIndex, InParmInfo.choiceCount);
+		}
+
+		case EHoudiniParameterType::Color:
+		{
+			UHoudiniParameterColor* ColorParam = Cast<UHoudiniParameterColor>(InParam);
+			if (!ColorParam)
+				return true;
+
+			const FLinearColor Color = ColorParam->GetColorValue();
+			return !AreParameterValuesEqual(&Color.R, FMath::Min(InParmInfo.size, 4),
+				InNodeValues.FloatValues, InParmInfo.floatValuesIndex, InParmInfo.size);
+		}
+
+		case EHoudiniParameterType::File:
+		case EHoudiniParameterType::FileDir:
+		case EHoudiniParameterType::FileGeo:
+		case EHoudiniParameterType::FileImage:
+		{
+			UHoudiniParameterFile* FileParam = Cast<UHoudiniParameterFile>(InParam);
+			if (!FileParam)
+				return true;
+
+			TArray<FString> Values;
+			for (int32 Idx = 0; Idx < FileParam->GetNumValues(); Idx++)
+				Values.Add(FileParam->GetValueAt(Idx));
+
+			return !AreParameterValuesEqual(Values.GetData(), Values.Num(),
+				InNodeValues.StringValues, InParmInfo.stringValuesIndex, InParmInfo.size);
+		}
+
+		case EHoudiniParameterType::Float:
+		{
+			UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(InParam);
+			if (!FloatParam)
+				return true;
+
+			return !AreParameterValuesEqual(FloatParam->GetValuesPtr(), FloatParam->GetNumberOfValues(),
+				InNodeValues.FloatValues, InParmInfo.floatValuesIndex, InParmInfo.size);
+		}
+
+		case EHoudiniParameterType::Int:
+		{
+			UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(InParam);
+			if (!IntParam)
+				return true;
+
+			return !AreParameterValuesEqual(IntParam->GetValuesPtr(), IntParam->GetNumberOfValues(),
+				InNodeValues.IntValues, InParmInfo.intValuesIndex, InParmInfo.size);
+		}
+
+		case EHoudiniParameterType::Toggle:
+		{
+			UHoudiniParameterToggle* ToggleParam = Cast<UHoudiniParameterToggle>(InParam);
+			if (!ToggleParam)
+				return true;
+
+			return !AreParameterValuesEqual(ToggleParam->GetValuesPtr(), ToggleParam->GetNumValues(),
+				InNodeValues.IntValues, InParmInfo.intValuesIndex, InParmInfo.size);
+		}
+
+		case EHoudiniParameterType::IntChoice:
+		{
+			UHoudiniParameterChoice* ChoiceParam = Cast<UHoudiniParameterChoice>(InParam);
+			if (!ChoiceParam)
+				return true;
+
+			const int32 IntValue = ChoiceParam->GetIntValue();
+			return !AreParameterValuesEqual(&IntValue, 1, InNodeValues.IntValues, InParmInfo.intValuesIndex, 1);
+		}
+
+		case EHoudiniParameterType::StringChoice:
+		{
+			UHoudiniParameterChoice* ChoiceParam = Cast<UHoudiniParameterChoice>(InParam);
+			if (!ChoiceParam)
+				return true;
+
+			const FString StringValue = ChoiceParam->GetStringValue();
+			return !AreParameterValuesEqual(&StringValue, 1, InNodeValues.StringValues, InParmInfo.stringValuesIndex, 1);
+		}
+
+		case EHoudiniParameterType::Label:
+		{
+			UHoudiniParameterLabel* LabelParam = Cast<UHoudiniParameterLabel>(InParam);
+			if (!LabelParam)
+				return true;
+
+			return !AreParameterValuesEqual(LabelParam->LabelStrings.GetData(), LabelParam->LabelStrings.Num(),
+				InNodeValues.StringValues, InParmInfo.stringValuesIndex, InParmInfo.size);
+		}
+
+		case EHoudiniParameterType::String:
+		case EHoudiniParameterType::StringAssetRef:
+		{
+			UHoudiniParameterString* StringParam = Cast<UHoudiniParameterString>(InParam);
+			if (!StringParam)
+				return true;
+
+			TArray<FString> Values;
+			for (int32 Idx = 0; Idx < StringParam->GetNumberOfValues(); Idx++)
+				Values.Add(StringParam->GetValueAt(Idx));
+
+			return !AreParameterValuesEqual(Values.GetData(), Values.Num(),
+				InNodeValues.StringValues, InParmInfo.stringValuesIndex, InParmInfo.size);
+		}
+
+		default:
+			return true;
+	}
+}
+
+// Indicates if the details panel layout needs to be rebuilt after a parameter has been updated by a cook that didn't change the parameter interface.
+// The widgets of the other parameters are bound to their values and are refreshed in place.
+static bool
+NeedsParameterLayoutRefresh(
+	UHoudiniParameter* InParam,
+	const HAPI_ParmInfo& InOldParmInfo, const HAPI_ParmInfo& InNewParmInfo,
+	const FHoudiniParameterNodeValues& InOldValues, const FHoudiniParameterNodeValues& InNewValues)
+{
+	if (InOldParmInfo.disabled != InNewParmInfo.disabled
+		|| InOldParmInfo.invisible != InNewParmInfo.invisible
+		|| InOldParmInfo.choiceCount != InNewParmInfo.choiceCount)
+		return true;
+
+	switch (InParam->GetParameterType())
+	{
+		case EHoudiniParameterType::Float:
+		case EHoudiniParameterType::Int:
+		case EHoudiniParameterType::Toggle:
+		case EHoudiniParameterType::String:
+		case EHoudiniParameterType::StringChoice:
+		case EHoudiniParameterType::IntChoice:
+		case EHoudiniParameterType::Color:
+		case EHoudiniParameterType::MultiParm:
+		case EHoudiniParameterType::Folder:
+		case EHoudiniParameterType::FolderList:
+			return false;
+
+		case EHoudiniParameterType::ColorRamp:
+		case EHoudiniParameterType::FloatRamp:
+			// Ramp points widgets are created from the points values
+			return HaveParameterValuesChanged(InOldValues.IntValues, InNewValues.IntValues, 0, InNewValues.IntValues.Num())
+				|| HaveParameterValuesChanged(InOldValues.FloatValues, InNewValues.FloatValues, 0, InNewValues.FloatValues.Num());
+
+		default:
+			return true;
+	}
+}
+
+// Reset the caching state of ramp parameters after they've been updated from HAPI
+static void
+ResetRampParameterCaching(UHoudiniParameter* InParam)
+{
+	switch (InParam->GetParameterType())
+	{
+		case EHoudiniParameterType::FloatRamp:
+		{
+			UHoudiniParameterRampFloat* FloatRampParam = Cast<UHoudiniParameterRampFloat>(InParam);
+			if (FloatRampParam)
+			{
+				UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(FloatRampParam->GetOuter());
+				if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
+					FloatRampParam->bCaching = false;
+			}
+
+			break;
+		}
+
+		case EHoudiniParameterType::ColorRamp:
+		{
+			UHoudiniParameterRampColor* ColorRampParam = Cast<UHoudiniParameterRampColor>(InParam);
+			if (ColorRampParam)
+			{
+				UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(ColorRampParam->GetOuter());
+				if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
+					ColorRampParam->bCaching = false;
+			}
+
+			break;
+		}
+
+		default:
+			break;
+	}
+}
+
+// Collects int and float parameter values so that contiguous value ranges can be uploaded with a single HAPI call
+struct FHoudiniParameterValueBatch
+{
+	void AddIntValues(const HAPI_NodeId& InNodeId, const int32* InValues, const int32& InStart, const int32& InCount)
+	{
+		TMap<int32, int32>& NodeValues = IntValues.FindOrAdd(InNodeId);
+		for (int32 Idx = 0; Idx < InCount; Idx++)
+			NodeValues.Add(InStart + Idx, InValues[Idx]);
+	}
+
+	void AddFloatValues(const HAPI_NodeId& InNodeId, const float* InValues, const int32& InStart, const int32& InCount)
+	{
+		TMap<int32, float>& NodeValues = FloatValues.FindOrAdd(InNodeId);
+		for (int32 Idx = 0; Idx < InCount; Idx++)
+			NodeValues.Add(InStart + Idx, InValues[Idx]);
+	}
+
+	// Upload all the collected values, one call per contiguous range
+	bool Upload()
+	{
+		bool bSuccess = UploadRanges(IntValues, [](const HAPI_NodeId& InNodeId, const int32* InValues, const int32& InStart, const int32& InCount)
+		{
+			return HAPI_RESULT_SUCCESS == FHoudiniApi::SetParmIntValues(
+				FHoudiniEngine::Get().GetSession(), InNodeId, InValues, InStart, InCount);
+		});
+
+		if (!UploadRanges(FloatValues, [](const HAPI_NodeId& InNodeId, const float* InValues, const int32& InStart, const int32& InCount)
+		{
+			return HAPI_RESULT_SUCCESS == FHoudiniApi::SetParmFloatValues(
+				FHoudiniEngine::Get().GetSession(), InNodeId, InValues, InStart, InCount);
+		}))
+		{
+			bSuccess = false;
+		}
+
+		return bSuccess;
+	}
+
+private:
+
+	template<typename T, typename FSetValues>
+	static bool UploadRanges(TMap<HAPI_NodeId, TMap<int32, T>>& InValues, FSetValues SetValues)
+	{
+		bool bSuccess = true;
+		for (auto& NodeValues : InValues)
+		{
+			NodeValues.Value.KeySort(TLess<int32>());
+
+			TArray<T> RangeValues;
+			int32 RangeStart = -1;
+			for (const auto& Value : NodeValues.Value)
+			{
+				if (RangeValues.Num() > 0 && Value.Key != RangeStart + RangeValues.Num())
+				{
+					if (!SetValues(NodeValues.Key, RangeValues.GetData(), RangeStart, RangeValues.Num()))
+						bSuccess = false;
+					RangeValues.Reset();
+				}
+
+				if (RangeValues.Num() <= 0)
+					RangeStart = Value.Key;
+				RangeValues.Add(Value.Value);
+			}
+
+			if (RangeValues.Num() > 0 && !SetValues(NodeValues.Key, RangeValues.GetData(), RangeStart, RangeValues.Num()))
+				bSuccess = false;
+		}
+
+		InValues.Empty();
+		return bSuccess;
+	}
+
+	TMap<HAPI_NodeId, TMap<int32, int32>> IntValues;
+	TMap<HAPI_NodeId, TMap<int32, float>> FloatValues;
+};
+
+// Add the values of a parameter to the batch if its type allows it
+static bool
+AddParameterValuesToBatch(UHoudiniParameter* InParam, FHoudiniParameterValueBatch& OutBatch)
+{
+	switch (InParam->GetParameterType())
+	{
+		case EHoudiniParameterType::Float:
+		{
+			UHoudiniParameterFloat* FloatParam = Cast<UHoudiniParameterFloat>(InParam);
+			if (!FloatParam || !FloatParam->GetValuesPtr())
+				return false;
+
+			OutBatch.AddFloatValues(FloatParam->GetNodeId(), FloatParam->GetValuesPtr(), FloatParam->GetValueIndex(), FloatParam->GetTupleSize());
+		}
+		break;
+
+		case EHoudiniParameterType::Int:
+		{
+			UHoudiniParameterInt* IntParam = Cast<UHoudiniParameterInt>(InParam);
+			if (!IntParam || !IntParam->GetValuesPtr())
+				return false;
+
+			OutBatch.AddIntValues(IntParam->GetNodeId(), IntParam->GetValuesPtr(), IntParam->GetValueIndex(), IntParam->GetTupleSize());
+		}
+		break;
+
+		case EHoudiniParameterType::IntChoice:
+		{
+			UHoudiniParameterChoice* ChoiceParam = Cast<UHoudiniParameterChoice>(InParam);
+			if (!ChoiceParam)
+				return false;
+
+			int32 IntValue = ChoiceParam->GetIntValue();
+			OutBatch.AddIntValues(ChoiceParam->GetNodeId(), &IntValue, ChoiceParam->GetValueIndex(), 1);
+		}
+		break;
+
+		case EHoudiniParameterType::Color:
+		{
+			UHoudiniParameterColor* ColorParam = Cast<UHoudiniParameterColor>(InParam);
+			if (!ColorParam)
+				return false;
+
+			FLinearColor Color = ColorParam->GetColorValue();
+			OutBatch.AddFloatValues(ColorParam->GetNodeId(), (float*)(&Color.R), ColorParam->GetValueIndex(), ColorParam->GetTupleSize() == 4 ? 4 : 3);
+		}
+		break;
+
+		case EHoudiniParameterType::Toggle:
+		{
+			UHoudiniParameterToggle* ToggleParam = Cast<UHoudiniParameterToggle>(InParam);
+			if (!ToggleParam || !ToggleParam->GetValuesPtr())
+				return false;
+
+			OutBatch.AddIntValues(ToggleParam->GetNodeId(), ToggleParam->GetValuesPtr(), ToggleParam->GetValueIndex(), ToggleParam->GetTupleSize());
+		}
+		break;
+
+		default:
+			// Other parameters trigger callbacks, use strings or modify the interface: upload them individually
+			return false;
+	}
+
+	return true;
+}
+
 // 
 bool 
 FHoudiniParameterTranslator::UpdateParameters(UHoudiniAssetComponent* HAC)
@@ -98,10 +574,128 @@ FHoudiniParameterTranslator::UpdateParameters(UHoudiniAssetComponent* HAC)
 		}
 		*/
 
-		// Replace with the new parameters
-		HAC->Parameters = NewParameters;
+		// Replace with the new parameters
+		HAC->Parameters = NewParameters;
+
+		// Update the asset's parameter templates if needed
+		CacheParameterTemplates(HAC);
+	}
+
+
+	return true;
+}
+
+bool
+FHoudiniParameterTranslator::CacheParameterTemplates(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return false;
+
+	UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
+	if (!HoudiniAsset || HoudiniAsset->IsPendingKill())
+		return false;
+
+	FHoudiniParameterInterfaceState* HACState = ParameterInterfaceStates.Find(HAC);
+	if (!HACState || HACState->ParmInfoIndices.Num() != HAC->Parameters.Num() || HAC->Parameters.Num() <= 0)
+		return false;
+
+	// Keep the current templates if the interface hasn't changed
+	FHoudiniParameterInterfaceState* TemplateState = ParameterInterfaceStates.Find(HoudiniAsset);
+	if (TemplateState && TemplateState->InterfaceHash == HACState->InterfaceHash
+		&& TemplateState->ParmInfoIndices.Num() == HoudiniAsset->ParameterTemplates.Num())
+		return true;
+
+	HoudiniAsset->ParameterTemplates.Empty();
+	ParameterInterfaceStates.Remove(HoudiniAsset);
+
+	for (UHoudiniParameter* CurrentParm : HAC->Parameters)
+	{
+		if (!CurrentParm || CurrentParm->IsPendingKill())
+			return false;
+
+		// Operator path parameters are tied to the HAC's inputs, they can't be shared
+		if (CurrentParm->GetParameterType() == EHoudiniParameterType::Input)
+			return false;
+	}
+
+	TArray<UHoudiniParameter*> Templates;
+	if (!DuplicateParameters(HAC->Parameters, GetTransientPackage(), Templates))
+		return false;
+
+	HoudiniAsset->ParameterTemplates = Templates;
+
+	// The templates' state is the same as the HAC's
+	FHoudiniParameterInterfaceState TemplateInterfaceState = *HACState;
+	ParameterInterfaceStates.Add(HoudiniAsset, MoveTemp(TemplateInterfaceState));
+
+	return true;
+}
+
+bool
+FHoudiniParameterTranslator::InitializeParametersFromTemplates(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill() || HAC->Parameters.Num() > 0)
+		return false;
+
+	UHoudiniAsset* HoudiniAsset = HAC->GetHoudiniAsset();
+	if (!HoudiniAsset || HoudiniAsset->IsPendingKill() || HoudiniAsset->ParameterTemplates.Num() <= 0)
+		return false;
+
+	FHoudiniParameterInterfaceState* TemplateState = ParameterInterfaceStates.Find(HoudiniAsset);
+	if (!TemplateState || TemplateState->ParmInfoIndices.Num() != HoudiniAsset->ParameterTemplates.Num())
+		return false;
+
+	TArray<UHoudiniParameter*> NewParameters;
+	if (!DuplicateParameters(HoudiniAsset->ParameterTemplates, HAC, NewParameters))
+		return false;
+
+	for (UHoudiniParameter* NewParm : NewParameters)
+		NewParm->SetNodeId(HAC->GetAssetId());
+
+	HAC->Parameters = NewParameters;
+
+	// When updating the parameters after the first cook, the interface will be considered unchanged
+	// and only the parameters whose values differ from the templates will be updated
+	FHoudiniParameterInterfaceState HACInterfaceState = *TemplateState;
+	ParameterInterfaceStates.Add(HAC, MoveTemp(HACInterfaceState));
+
+	return true;
+}
+
+bool
+FHoudiniParameterTranslator::DuplicateParameters(
+	const TArray<UHoudiniParameter*>& InParameters,
+	UObject* InOuter,
+	TArray<UHoudiniParameter*>& OutParameters)
+{
+	OutParameters.Empty();
+
+	TMap<UObject*, UObject*> DuplicatedParameters;
+	for (UHoudiniParameter* CurrentParm : InParameters)
+	{
+		if (!CurrentParm || CurrentParm->IsPendingKill())
+			return false;
+
+		FName DuplicateName = MakeUniqueObjectName(InOuter, CurrentParm->GetClass(), FName(*CurrentParm->GetFName().GetPlainNameString()));
+		UHoudiniParameter* DuplicatedParm = DuplicateObject<UHoudiniParameter>(CurrentParm, InOuter, DuplicateName);
+		if (!DuplicatedParm)
+			return false;
+
+		OutParameters.Add(DuplicatedParm);
+		DuplicatedParameters.Add(CurrentParm, DuplicatedParm);
 	}
 
+	// Parameters reference each other (folder list tabs, ramp points...), 
+	// replace the references to the source parameters with their duplicates
+	for (UHoudiniParameter* DuplicatedParm : OutParameters)
+	{
+		TArray<UObject*> ObjectsToRemap;
+		GetObjectsWithOuter(DuplicatedParm, ObjectsToRemap, true);
+		ObjectsToRemap.Add(DuplicatedParm);
+
+		for (UObject* CurrentObject : ObjectsToRemap)
+			FArchiveReplaceObjectRef<UObject> ReplaceObjectRefAr(CurrentObject, DuplicatedParameters, false, true, true);
+	}
 
 	return true;
 }
@@ -234,6 +828,77 @@ FHoudiniParameterTranslator::BuildAllParameters(
 	HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParameters(
 			FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &ParmInfos[0], 0,	NodeInfo.parmCount), false);
 
+	// Retrieve all the parameter values at once
+	FHoudiniParameterNodeValues NodeValues;
+	FHoudiniParameterTranslator::HapiGetNodeParameterValues(AssetInfo.nodeId, NodeInfo, NodeValues);
+
+	// Parameter tags are cached per asset definition
+	FString AssetOpName;
+	FString AssetVersion;
+	if (FHoudiniEngineString::ToFString(AssetInfo.fullOpNameSH, AssetOpName))
+	{
+		FHoudiniEngineString::ToFString(AssetInfo.versionSH, AssetVersion);
+		NodeValues.AssetDefinitionKey = AssetOpName + TEXT("@") + AssetVersion;
+	}
+
+	// If the interface hasn't changed since the last time we built the parameters, we can keep the
+	// existing parameters and only update those whose state or values have been modified by the cook
+	const uint64 InterfaceHash = GetParameterInterfaceHash(AssetInfo.nodeId, NodeInfo, ParmInfos);
+	if (bUpdateValues && !InForceFullUpdate && Outer)
+	{
+		FHoudiniParameterInterfaceState* InterfaceState = ParameterInterfaceStates.Find(Outer);
+		if (InterfaceState && InterfaceState->InterfaceHash == InterfaceHash
+			&& InterfaceState->ParmInfos.Num() == ParmInfos.Num()
+			&& InterfaceState->ParmInfoIndices.Num() == CurrentParameters.Num())
+		{
+			bool bInterfaceUnchanged = true;
+			for (int32 Idx = 0; Idx < CurrentParameters.Num(); Idx++)
+			{
+				UHoudiniParameter* CurrentParm = CurrentParameters[Idx];
+				const int32 ParmInfoIdx = InterfaceState->ParmInfoIndices[Idx];
+				if (!CurrentParm || CurrentParm->IsPendingKill() || !ParmInfos.IsValidIndex(ParmInfoIdx)
+					|| CurrentParm->GetParmId() != ParmInfos[ParmInfoIdx].id)
+				{
+					bInterfaceUnchanged = false;
+					break;
+				}
+			}
+
+			if (bInterfaceUnchanged)
+			{
+				bool bParametersUpdated = false;
+				bool bNeedsLayoutRefresh = false;
+				for (int32 Idx = 0; Idx < CurrentParameters.Num(); Idx++)
+				{
+					UHoudiniParameter* CurrentParm = CurrentParameters[Idx];
+					const int32 ParmInfoIdx = InterfaceState->ParmInfoIndices[Idx];
+					if (!NeedsParameterUpdate(CurrentParm, ParmInfos[ParmInfoIdx], NodeValues))
+						continue;
+
+					if (FHoudiniParameterTranslator::UpdateParameterFromInfo(CurrentParm, AssetInfo.nodeId, ParmInfos[ParmInfoIdx], false, true, &NodeValues))
+					{
+						ResetRampParameterCaching(CurrentParm);
+						bParametersUpdated = true;
+
+						if (!bNeedsLayoutRefresh)
+							bNeedsLayoutRefresh = NeedsParameterLayoutRefresh(CurrentParm, InterfaceState->ParmInfos[ParmInfoIdx], ParmInfos[ParmInfoIdx], InterfaceState->NodeValues, NodeValues);
+					}
+				}
+
+				InterfaceState->ParmInfos = ParmInfos;
+				InterfaceState->NodeValues = NodeValues;
+
+				NewParameters = CurrentParameters;
+
+				// Only rebuild the details panel if some widgets can't be refreshed in place
+				if (bParametersUpdated)
+					FHoudiniEngineUtils::UpdateEditorProperties(Outer, bNeedsLayoutRefresh);
+
+				return true;
+			}
+		}
+	}
+
 	// Create a name lookup cache for the current parameters
 	TMap<FString, UHoudiniParameter*> CurrentParametersByName;
 	CurrentParametersByName.Reserve(CurrentParameters.Num());
@@ -246,6 +911,7 @@ FHoudiniParameterTranslator::BuildAllParameters(
 
 	// Create properties for parameters.
 	TArray<HAPI_ParmId> NewParmIds;
+	TArray<int32> NewParmInfoIndices;
 	for (int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx)
 	{
 		
@@ -339,47 +1005,18 @@ FHoudiniParameterTranslator::BuildAllParameters(
 			CurrentParametersByName.Remove(NewParmName);
 
 			// Do a fast update of this parameter
-			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(HoudiniAssetParameter, AssetInfo.nodeId, ParmInfo, InForceFullUpdate, bUpdateValues))
+			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(HoudiniAssetParameter, AssetInfo.nodeId, ParmInfo, InForceFullUpdate, bUpdateValues, &NodeValues))
 				continue;
 
 			// Reset the states of ramp parameters.
-			switch (HoudiniAssetParameter->GetParameterType())
-			{
-
-				case EHoudiniParameterType::FloatRamp:
-				{
-					UHoudiniParameterRampFloat* FloatRampParam = Cast<UHoudiniParameterRampFloat>(HoudiniAssetParameter);
-					if (FloatRampParam)
-					{
-						UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(FloatRampParam->GetOuter());
-						if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
-							FloatRampParam->bCaching = false;
-					}
-
-					break;
-				}
-
-				case EHoudiniParameterType::ColorRamp:
-				{
-					UHoudiniParameterRampColor* ColorRampParam = Cast<UHoudiniParameterRampColor>(HoudiniAssetParameter);
-					if (ColorRampParam)
-					{
-						UHoudiniAssetComponent* ParentHAC = Cast<UHoudiniAssetComponent>(ColorRampParam->GetOuter());
-						if (ParentHAC && !ParentHAC->HasBeenLoaded() && !ParentHAC->HasBeenDuplicated())
-							ColorRampParam->bCaching = false;
-					}
-
-					break;
-				}
-			}
-
+			ResetRampParameterCaching(HoudiniAssetParameter);
 		}
 		else
 		{	
 			// Create a new parameter object of the appropriate type
 			HoudiniAssetParameter = CreateTypedParameter(Outer, ParmType, NewParmName);
 			// Fully update this parameter
-			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(HoudiniAssetParameter, AssetInfo.nodeId, ParmInfo, true, true))
+			if (!FHoudiniParameterTranslator::UpdateParameterFromInfo(HoudiniAssetParameter, AssetInfo.nodeId, ParmInfo, true, true, &NodeValues))
 				continue;
 
 		}
@@ -387,6 +1024,7 @@ FHoudiniParameterTranslator::BuildAllParameters(
 		// Add the new parameters
 		NewParameters.Add(HoudiniAssetParameter);
 		NewParmIds.Add(ParmInfo.id);
+		NewParmInfoIndices.Add(ParamIdx);
 
 
 		// Check if the parameter is a direct child of a multiparam.
@@ -443,6 +1081,23 @@ FHoudiniParameterTranslator::BuildAllParameters(
 		}
 	}
 
+	// Keep track of the interface we just built so the next update can skip rebuilding it if it hasn't changed
+	if (Outer)
+	{
+		// Clean up the states of destroyed objects
+		for (auto Iter = ParameterInterfaceStates.CreateIterator(); Iter; ++Iter)
+		{
+			if (!Iter.Key().IsValid())
+				Iter.RemoveCurrent();
+		}
+
+		FHoudiniParameterInterfaceState& InterfaceState = ParameterInterfaceStates.Add(Outer);
+		InterfaceState.InterfaceHash = InterfaceHash;
+		InterfaceState.ParmInfoIndices = NewParmInfoIndices;
+		InterfaceState.ParmInfos = ParmInfos;
+		InterfaceState.NodeValues = NodeValues;
+	}
+
 	FHoudiniEngineUtils::UpdateEditorProperties(Outer, true);
 
 	return true;
@@ -1050,7 +1705,7 @@ FHoudiniParameterTranslator::CreateTypedParameter(UObject * Outer, const EHoudin
 bool
 FHoudiniParameterTranslator::UpdateParameterFromInfo(
 	UHoudiniParameter * HoudiniParameter, const HAPI_NodeId& InNodeId, const HAPI_ParmInfo& ParmInfo,
-	const bool& bFullUpdate, const bool& bUpdateValue)
+	const bool& bFullUpdate, const bool& bUpdateValue, const FHoudiniParameterNodeValues* InNodeValues)
 {
 	if (!HoudiniParameter || HoudiniParameter->IsPendingKill())
 		return false;
@@ -1061,6 +1716,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 	HoudiniParameter->SetParentParmId(ParmInfo.parentId);
 
 	HoudiniParameter->SetChildIndex(ParmInfo.childIndex);
+	HoudiniParameter->SetInstanceNum(ParmInfo.instanceNum);
 	HoudiniParameter->SetTagCount(ParmInfo.tagCount);
 	HoudiniParameter->SetTupleSize(ParmInfo.size);
 
@@ -1153,39 +1809,10 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 		}
 		
 		// Get parameter tags.
-		int32 TagCount = HoudiniParameter->GetTagCount();
-		for (int32 Idx = 0; Idx < TagCount; ++Idx)
-		{
-			HAPI_StringHandle TagNameSH;
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmTagName(
-				FHoudiniEngine::Get().GetSession(),
-				InNodeId, ParmInfo.id, Idx, &TagNameSH))
-			{
-				HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag name: parmId: %d, tag index: %d"), ParmInfo.id, Idx);
-				continue;
-			}
-
-			FString NameString = TEXT("");
-			FHoudiniEngineString::ToFString(TagNameSH, NameString);
-			if (NameString.IsEmpty())
-			{
-				HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag name: parmId: %d, tag index: %d"), ParmInfo.id, Idx);
-				continue;
-			}
-
-			HAPI_StringHandle TagValueSH;
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmTagValue(
-				FHoudiniEngine::Get().GetSession(),
-				InNodeId, ParmInfo.id, TCHAR_TO_ANSI(*NameString), &TagValueSH))
-			{
-				HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag value: parmId: %d, tag: %s"), ParmInfo.id, *NameString);
-			}
-
-			FString ValueString = TEXT("");
-			FHoudiniEngineString::ToFString(TagValueSH, ValueString);
-
-			HoudiniParameter->GetTags().Add(NameString, ValueString);
-		}
+		TMap<FString, FString> ParmTags;
+		FHoudiniParameterTranslator::HapiGetParameterTags(
+			InNodeId, ParmInfo, Name, InNodeValues ? InNodeValues->AssetDefinitionKey : FString(), ParmTags);
+		HoudiniParameter->GetTags().Append(ParmTags);
 	}
 
 	//
@@ -1237,10 +1864,8 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					}
 				}
 
-				if (FHoudiniApi::GetParmIntValues(
-					FHoudiniEngine::Get().GetSession(), InNodeId,
-					HoudiniParameterButtonStrip->GetValuesPtr(),
-					ParmInfo.intValuesIndex, ParmInfo.choiceCount) != HAPI_RESULT_SUCCESS)
+				if (!GetParmIntValues(InNodeId, InNodeValues, HoudiniParameterButtonStrip->GetValuesPtr(),
+					ParmInfo.intValuesIndex, ParmInfo.choiceCount))
 				{
 					return false;
 				}
@@ -1261,9 +1886,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual value for this property.
 					FLinearColor Color = FLinearColor::White;
-					if (FHoudiniApi::GetParmFloatValues(
-						FHoudiniEngine::Get().GetSession(), InNodeId,
-						(float *)&Color.R, ParmInfo.floatValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+					if (!GetParmFloatValues(InNodeId, InNodeValues, (float *)&Color.R, ParmInfo.floatValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
@@ -1285,6 +1908,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 			UHoudiniParameterRampColor* HoudiniParameterRampColor = Cast<UHoudiniParameterRampColor>(HoudiniParameter);
 			if (HoudiniParameterRampColor && !HoudiniParameterRampColor->IsPendingKill())
 			{
+				HoudiniParameterRampColor->SetValueIndex(ParmInfo.intValuesIndex);
 				HoudiniParameterRampColor->SetInstanceCount(ParmInfo.instanceCount);
 				HoudiniParameterRampColor->MultiParmInstanceLength = ParmInfo.instanceLength;
 			}
@@ -1295,6 +1919,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 			UHoudiniParameterRampFloat* HoudiniParameterRampFloat = Cast<UHoudiniParameterRampFloat>(HoudiniParameter);
 			if (HoudiniParameterRampFloat && !HoudiniParameterRampFloat->IsPendingKill())
 			{
+				HoudiniParameterRampFloat->SetValueIndex(ParmInfo.intValuesIndex);
 				HoudiniParameterRampFloat->SetInstanceCount(ParmInfo.instanceCount);
 				HoudiniParameterRampFloat->MultiParmInstanceLength = ParmInfo.instanceLength;
 			}	
@@ -1317,10 +1942,10 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Check if we are read-only
 					bool bIsReadOnly = false;
-					FString FileChooserTag;
-					if (FHoudiniParameterTranslator::HapiGetParameterTagValue(InNodeId, ParmInfo.id, HAPI_PARAM_TAG_FILE_READONLY, FileChooserTag))
+					const FString* FileChooserTag = HoudiniParameter->GetTags().Find(TEXT(HAPI_PARAM_TAG_FILE_READONLY));
+					if (FileChooserTag)
 					{
-						if (FileChooserTag.Equals(TEXT("read"), ESearchCase::IgnoreCase))
+						if (FileChooserTag->Equals(TEXT("read"), ESearchCase::IgnoreCase))
 							bIsReadOnly = true;
 					}
 					HoudiniParameterFile->SetReadOnly(bIsReadOnly);
@@ -1341,26 +1966,14 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				if (bUpdateValue)
 				{
 					// Get the actual values for this property.
-					TArray< HAPI_StringHandle > StringHandles;
-					StringHandles.SetNumZeroed(ParmInfo.size);
-					if (FHoudiniApi::GetParmStringValues(
-						FHoudiniEngine::Get().GetSession(), InNodeId, false,
-						&StringHandles[0], ParmInfo.stringValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
-					{
+					TArray<FString> StringValues;
+					if (!GetParmStringValues(InNodeId, InNodeValues, StringValues, ParmInfo.stringValuesIndex, ParmInfo.size))
 						return false;
-					}
 
-					// Convert HAPI string handles to Unreal strings.
+					// Update the parameter values
 					HoudiniParameterFile->SetNumberOfValues(ParmInfo.size);
-					for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
-					{
-						FString ValueString = TEXT("");
-						FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
-						HoudiniEngineString.ToFString(ValueString);
-
-						// Update the parameter value
-						HoudiniParameterFile->SetValueAt(ValueString, Idx);
-					}
+					for (int32 Idx = 0; Idx < StringValues.Num(); ++Idx)
+						HoudiniParameterFile->SetValueAt(StringValues[Idx], Idx);
 				}
 
 				if (bFullUpdate) 
@@ -1383,10 +1996,8 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Update the parameter's value
 					HoudiniParameterFloat->SetNumberOfValues(ParmInfo.size);
-					if (FHoudiniApi::GetParmFloatValues(
-							FHoudiniEngine::Get().GetSession(), InNodeId,
-							HoudiniParameterFloat->GetValuesPtr(),
-							ParmInfo.floatValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+					if (!GetParmFloatValues(InNodeId, InNodeValues, HoudiniParameterFloat->GetValuesPtr(),
+							ParmInfo.floatValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
@@ -1405,12 +2016,12 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Only update Unit, no swap, and Min/Max values when doing a full update
 
 					// Get the parameter's unit from the "unit" tag
-					FString ParamUnit;
-					FHoudiniParameterTranslator::HapiGetParameterUnit(InNodeId, ParmInfo.id, ParamUnit);
+					const FString* ParamUnitTag = HoudiniParameter->GetTags().Find(TEXT(HAPI_PARAM_TAG_UNITS));
+					FString ParamUnit = ParamUnitTag ? ConvertParameterUnitTag(*ParamUnitTag) : FString();
 					HoudiniParameterFloat->SetUnit(ParamUnit);
 
 					// Get the parameter's no swap tag (hengine_noswap)
-					HoudiniParameterFloat->SetNoSwap(HapiGetParameterHasTag(InNodeId, ParmInfo.id, HAPI_PARAM_TAG_NOSWAP));
+					HoudiniParameterFloat->SetNoSwap(HoudiniParameter->GetTags().Contains(TEXT(HAPI_PARAM_TAG_NOSWAP)));
 
 					// Set the min and max for this parameter
 					if (ParmInfo.hasMin)
@@ -1584,10 +2195,8 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual values for this property.
 					HoudiniParameterInt->SetNumberOfValues(ParmInfo.size);
-					if (FHoudiniApi::GetParmIntValues(
-						FHoudiniEngine::Get().GetSession(), InNodeId,
-						HoudiniParameterInt->GetValuesPtr(),
-						ParmInfo.intValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+					if (!GetParmIntValues(InNodeId, InNodeValues, HoudiniParameterInt->GetValuesPtr(),
+						ParmInfo.intValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
@@ -1605,8 +2214,8 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					// Only update unit and Min/Max values for a full update
 
 					// Get the parameter's unit from the "unit" tag
-					FString ParamUnit;
-					FHoudiniParameterTranslator::HapiGetParameterUnit(InNodeId, ParmInfo.id, ParamUnit);
+					const FString* ParamUnitTag = HoudiniParameter->GetTags().Find(TEXT(HAPI_PARAM_TAG_UNITS));
+					FString ParamUnit = ParamUnitTag ? ConvertParameterUnitTag(*ParamUnitTag) : FString();
 					HoudiniParameterInt->SetUnit(ParamUnit);
 
 					// Set the min and max for this parameter
@@ -1681,10 +2290,8 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual values for this property.
 					int32 CurrentIntValue = 0;
-					HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIntValues(
-						FHoudiniEngine::Get().GetSession(),
-						InNodeId, &CurrentIntValue,
-						ParmInfo.intValuesIndex, ParmInfo.size), false);
+					if (!GetParmIntValues(InNodeId, InNodeValues, &CurrentIntValue, ParmInfo.intValuesIndex, 1))
+						return false;
 
 					// Check the value is valid
 					if (CurrentIntValue >= ParmInfo.choiceCount)
@@ -1756,18 +2363,11 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				if (bUpdateValue)
 				{
 					// Get the actual values for this property.
-					HAPI_StringHandle StringHandle;
-					HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmStringValues(
-						FHoudiniEngine::Get().GetSession(),
-						InNodeId, false, &StringHandle,
-						ParmInfo.stringValuesIndex, ParmInfo.size), false);
-
-					// Get the string value
-					FString StringValue;
-					FHoudiniEngineString HoudiniEngineString(StringHandle);
-					HoudiniEngineString.ToFString(StringValue);
+					TArray<FString> StringValues;
+					if (!GetParmStringValues(InNodeId, InNodeValues, StringValues, ParmInfo.stringValuesIndex, 1))
+						return false;
 
-					HoudiniParameterStringChoice->SetStringValue(StringValue);
+					HoudiniParameterStringChoice->SetStringValue(StringValues[0]);
 				}
 
 				// Get the choice descriptors
@@ -1840,23 +2440,12 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				HoudiniParameterLabel->SetValueIndex(ParmInfo.stringValuesIndex);
 
 				// Get the actual value for this property.
-				TArray<HAPI_StringHandle> StringHandles;
-				StringHandles.SetNumZeroed(ParmInfo.size);
-				FHoudiniApi::GetParmStringValues(
-					FHoudiniEngine::Get().GetSession(),
-					InNodeId, false, &StringHandles[0],
-					ParmInfo.stringValuesIndex, ParmInfo.size);
+				TArray<FString> StringValues;
+				GetParmStringValues(InNodeId, InNodeValues, StringValues, ParmInfo.stringValuesIndex, ParmInfo.size);
 				
 				HoudiniParameterLabel->EmptyLabelString();
-
-				// Convert HAPI string handles to Unreal strings.
-				for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
-				{
-					FString ValueString = TEXT("");
-					FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
-					HoudiniEngineString.ToFString(ValueString);
+				for (const FString& ValueString : StringValues)
 					HoudiniParameterLabel->AddLabelString(ValueString);
-				}
 			}
 		}
 		break;
@@ -1874,9 +2463,8 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 
 				// Set the multiparm value
 				int32 MultiParmValue = 0;
-				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetParmIntValues(
-					FHoudiniEngine::Get().GetSession(),
-					InNodeId, &MultiParmValue, ParmInfo.intValuesIndex, 1), false);
+				if (!GetParmIntValues(InNodeId, InNodeValues, &MultiParmValue, ParmInfo.intValuesIndex, 1))
+					return false;
 
 				HoudiniParameterMulti->SetValue(MultiParmValue);
 				HoudiniParameterMulti->MultiParmInstanceCount = ParmInfo.instanceCount;
@@ -1923,25 +2511,13 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				if (bUpdateValue)
 				{
 					// Get the actual value for this property.
-					TArray< HAPI_StringHandle > StringHandles;
-					StringHandles.SetNumZeroed(ParmInfo.size);
-					if (FHoudiniApi::GetParmStringValues(
-						FHoudiniEngine::Get().GetSession(),
-						InNodeId, false, &StringHandles[0],
-						ParmInfo.stringValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
-					{
+					TArray<FString> StringValues;
+					if (!GetParmStringValues(InNodeId, InNodeValues, StringValues, ParmInfo.stringValuesIndex, ParmInfo.size))
 						return false;
-					}
 
-					// Convert HAPI string handles to Unreal strings.
 					HoudiniParameterString->SetNumberOfValues(ParmInfo.size);
-					for (int32 Idx = 0; Idx < StringHandles.Num(); ++Idx)
-					{
-						FString ValueString = TEXT("");
-						FHoudiniEngineString HoudiniEngineString(StringHandles[Idx]);
-						HoudiniEngineString.ToFString(ValueString);
-						HoudiniParameterString->SetValueAt(ValueString, Idx);
-					}
+					for (int32 Idx = 0; Idx < StringValues.Num(); ++Idx)
+						HoudiniParameterString->SetValueAt(StringValues[Idx], Idx);
 				}
 
 				if (bFullUpdate)
@@ -1950,7 +2526,7 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 					HoudiniParameterString->SetDefaultValues();
 					// Check if the parameter has the "asset_ref" tag
 					HoudiniParameterString->SetIsAssetRef(
-						FHoudiniParameterTranslator::HapiGetParameterHasTag(InNodeId, ParmInfo.id, HAPI_PARAM_TAG_ASSET_REF));
+						HoudiniParameter->GetTags().Contains(TEXT(HAPI_PARAM_TAG_ASSET_REF)));
 				}
 			}
 		}
@@ -1972,10 +2548,8 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 				{
 					// Get the actual values for this property.
 					HoudiniParameterToggle->SetNumberOfValues(ParmInfo.size);
-					if (FHoudiniApi::GetParmIntValues(
-						FHoudiniEngine::Get().GetSession(), InNodeId,
-						HoudiniParameterToggle->GetValuesPtr(),
-						ParmInfo.intValuesIndex, ParmInfo.size) != HAPI_RESULT_SUCCESS)
+					if (!GetParmIntValues(InNodeId, InNodeValues, HoudiniParameterToggle->GetValuesPtr(),
+						ParmInfo.intValuesIndex, ParmInfo.size))
 					{
 						return false;
 					}
@@ -1999,6 +2573,200 @@ FHoudiniParameterTranslator::UpdateParameterFromInfo(
 	return true;
 }
 
+bool
+FHoudiniParameterTranslator::HapiGetNodeParameterValues(
+	const HAPI_NodeId& InNodeId, const HAPI_NodeInfo& InNodeInfo, FHoudiniParameterNodeValues& OutNodeValues)
+{
+	OutNodeValues.IntValues.SetNumZeroed(FMath::Max(InNodeInfo.parmIntValueCount, 0));
+	OutNodeValues.FloatValues.SetNumZeroed(FMath::Max(InNodeInfo.parmFloatValueCount, 0));
+	OutNodeValues.StringValues.Empty();
+
+	bool bSuccess = true;
+	if (OutNodeValues.IntValues.Num() > 0 && HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmIntValues(
+		FHoudiniEngine::Get().GetSession(), InNodeId,
+		OutNodeValues.IntValues.GetData(), 0, OutNodeValues.IntValues.Num()))
+	{
+		OutNodeValues.IntValues.Empty();
+		bSuccess = false;
+	}
+
+	if (OutNodeValues.FloatValues.Num() > 0 && HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmFloatValues(
+		FHoudiniEngine::Get().GetSession(), InNodeId,
+		OutNodeValues.FloatValues.GetData(), 0, OutNodeValues.FloatValues.Num()))
+	{
+		OutNodeValues.FloatValues.Empty();
+		bSuccess = false;
+	}
+
+	if (InNodeInfo.parmStringValueCount > 0)
+	{
+		TArray<HAPI_StringHandle> StringHandles;
+		StringHandles.SetNumZeroed(InNodeInfo.parmStringValueCount);
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetParmStringValues(
+			FHoudiniEngine::Get().GetSession(), InNodeId, false,
+			StringHandles.GetData(), 0, StringHandles.Num()))
+		{
+			FHoudiniEngineString::SHArrayToFStringArray(StringHandles, OutNodeValues.StringValues);
+		}
+		else
+		{
+			bSuccess = false;
+		}
+	}
+
+	return bSuccess;
+}
+
+bool
+FHoudiniParameterTranslator::GetParmIntValues(
+	const HAPI_NodeId& InNodeId, const FHoudiniParameterNodeValues* InNodeValues,
+	int32* OutValues, const int32& InStart, const int32& InCount)
+{
+	if (InCount <= 0)
+		return true;
+
+	if (InNodeValues && InStart >= 0 && InStart + InCount <= InNodeValues->IntValues.Num())
+	{
+		FMemory::Memcpy(OutValues, InNodeValues->IntValues.GetData() + InStart, InCount * sizeof(int32));
+		return true;
+	}
+
+	return HAPI_RESULT_SUCCESS == FHoudiniApi::GetParmIntValues(
+		FHoudiniEngine::Get().GetSession(), InNodeId, OutValues, InStart, InCount);
+}
+
+bool
+FHoudiniParameterTranslator::GetParmFloatValues(
+	const HAPI_NodeId& InNodeId, const FHoudiniParameterNodeValues* InNodeValues,
+	float* OutValues, const int32& InStart, const int32& InCount)
+{
+	if (InCount <= 0)
+		return true;
+
+	if (InNodeValues && InStart >= 0 && InStart + InCount <= InNodeValues->FloatValues.Num())
+	{
+		FMemory::Memcpy(OutValues, InNodeValues->FloatValues.GetData() + InStart, InCount * sizeof(float));
+		return true;
+	}
+
+	return HAPI_RESULT_SUCCESS == FHoudiniApi::GetParmFloatValues(
+		FHoudiniEngine::Get().GetSession(), InNodeId, OutValues, InStart, InCount);
+}
+
+bool
+FHoudiniParameterTranslator::GetParmStringValues(
+	const HAPI_NodeId& InNodeId, const FHoudiniParameterNodeValues* InNodeValues,
+	TArray<FString>& OutValues, const int32& InStart, const int32& InCount)
+{
+	OutValues.Empty();
+	if (InCount <= 0)
+		return true;
+
+	if (InNodeValues && InStart >= 0 && InStart + InCount <= InNodeValues->StringValues.Num())
+	{
+		OutValues.Append(InNodeValues->StringValues.GetData() + InStart, InCount);
+		return true;
+	}
+
+	TArray<HAPI_StringHandle> StringHandles;
+	StringHandles.SetNumZeroed(InCount);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmStringValues(
+		FHoudiniEngine::Get().GetSession(), InNodeId, false,
+		StringHandles.GetData(), InStart, InCount))
+	{
+		return false;
+	}
+
+	FHoudiniEngineString::SHArrayToFStringArray(StringHandles, OutValues);
+	return true;
+}
+
+// Tags of the parameters of each asset definition, keyed by asset definition and parameter name
+static TMap<FString, TMap<FString, FString>> ParameterTagsCache;
+
+bool
+FHoudiniParameterTranslator::HapiGetParameterTags(
+	const HAPI_NodeId& InNodeId,
+	const HAPI_ParmInfo& InParmInfo,
+	const FString& InParmName,
+	const FString& InAssetDefinitionKey,
+	TMap<FString, FString>& OutTags)
+{
+	OutTags.Empty();
+	if (InParmInfo.tagCount <= 0)
+		return true;
+
+	// Spare parameters are not part of the asset definition, don't cache their tags
+	FString CacheKey;
+	if (!InAssetDefinitionKey.IsEmpty() && !InParmInfo.spare && !InParmName.IsEmpty())
+	{
+		CacheKey = InAssetDefinitionKey + TEXT("/") + InParmName;
+		TMap<FString, FString>* FoundTags = ParameterTagsCache.Find(CacheKey);
+		if (FoundTags)
+		{
+			OutTags = *FoundTags;
+			return true;
+		}
+	}
+
+	// Get the names of all the tags, then convert them at once
+	TArray<HAPI_StringHandle> TagNameHandles;
+	TagNameHandles.SetNumZeroed(InParmInfo.tagCount);
+	for (int32 Idx = 0; Idx < InParmInfo.tagCount; ++Idx)
+	{
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmTagName(
+			FHoudiniEngine::Get().GetSession(),
+			InNodeId, InParmInfo.id, Idx, &TagNameHandles[Idx]))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag name: parmId: %d, tag index: %d"), InParmInfo.id, Idx);
+			TagNameHandles[Idx] = -1;
+		}
+	}
+
+	TArray<FString> TagNames;
+	FHoudiniEngineString::SHArrayToFStringArray(TagNameHandles, TagNames);
+
+	// Then do the same for the tag values
+	TArray<HAPI_StringHandle> TagValueHandles;
+	TagValueHandles.SetNumZeroed(TagNames.Num());
+	for (int32 Idx = 0; Idx < TagNames.Num(); ++Idx)
+	{
+		TagValueHandles[Idx] = -1;
+		if (TagNames[Idx].IsEmpty())
+			continue;
+
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetParmTagValue(
+			FHoudiniEngine::Get().GetSession(),
+			InNodeId, InParmInfo.id, TCHAR_TO_ANSI(*TagNames[Idx]), &TagValueHandles[Idx]))
+		{
+			HOUDINI_LOG_WARNING(TEXT("Failed to retrive parameter tag value: parmId: %d, tag: %s"), InParmInfo.id, *TagNames[Idx]);
+			TagValueHandles[Idx] = -1;
+		}
+	}
+
+	TArray<FString> TagValues;
+	FHoudiniEngineString::SHArrayToFStringArray(TagValueHandles, TagValues);
+
+	for (int32 Idx = 0; Idx < TagNames.Num(); ++Idx)
+	{
+		if (TagNames[Idx].IsEmpty())
+			continue;
+
+		OutTags.Add(TagNames[Idx], TagValues[Idx]);
+	}
+
+	if (!CacheKey.IsEmpty())
+		ParameterTagsCache.Add(CacheKey, OutTags);
+
+	return true;
+}
+
+void
+FHoudiniParameterTranslator::ClearParameterTagsCache()
+{
+	ParameterTagsCache.Empty();
+}
+
 bool
 FHoudiniParameterTranslator::HapiGetParameterTagValue(const HAPI_NodeId& NodeId, const HAPI_ParmId& ParmId, const FString& Tag, FString& TagValue)
 {
@@ -2043,7 +2811,17 @@ FHoudiniParameterTranslator::HapiGetParameterUnit(const HAPI_NodeId& NodeId, con
 	FString UnitString = TEXT("");
 	if (!FHoudiniParameterTranslator::HapiGetParameterTagValue(NodeId, ParmId, "units", UnitString))
 		return false;
-	
+
+	OutUnitString = ConvertParameterUnitTag(UnitString);
+
+	return true;
+}
+
+FString
+FHoudiniParameterTranslator::ConvertParameterUnitTag(const FString& InUnitTag)
+{
+	FString UnitString = InUnitTag;
+
 	// We need to do some replacement in the string here in order to be able to get the
 	// proper unit type when calling FUnitConversion::UnitFromString(...) after.
 
@@ -2057,9 +2835,7 @@ FHoudiniParameterTranslator::HapiGetParameterUnit(const HAPI_NodeId& NodeId, con
 	UnitString.ReplaceInline(TEXT("1"), TEXT(""));
 	UnitString.ReplaceInline(TEXT("--"), TEXT("-1"));
 
-	OutUnitString = UnitString;
-
-	return true;
+	return UnitString;
 }
 
 bool
@@ -2083,12 +2859,41 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 
 	TMap<FString, UHoudiniParameter*> RampsToRevert;
 
+	// The values of simple parameters are collected and uploaded together
+	FHoudiniParameterValueBatch ValueBatch;
+	TArray<UHoudiniParameter*> BatchedParameters;
+	auto UploadValueBatch = [&ValueBatch, &BatchedParameters]()
+	{
+		if (BatchedParameters.Num() <= 0)
+			return;
+
+		const bool bBatchSuccess = ValueBatch.Upload();
+		for (UHoudiniParameter* BatchedParm : BatchedParameters)
+		{
+			if (bBatchSuccess)
+				BatchedParm->MarkChanged(false);
+			else
+				BatchedParm->SetNeedsToTriggerUpdate(false);
+		}
+
+		BatchedParameters.Empty();
+	};
+
 	for (int32 ParmIdx = 0; ParmIdx < HAC->GetNumParameters(); ParmIdx++)
 	{
 		UHoudiniParameter*& CurrentParm = HAC->Parameters[ParmIdx];
 		if (!CurrentParm || CurrentParm->IsPendingKill() || !CurrentParm->HasChanged())
 			continue;
 
+		if (!CurrentParm->IsPendingRevertToDefault() && AddParameterValuesToBatch(CurrentParm, ValueBatch))
+		{
+			BatchedParameters.Add(CurrentParm);
+			continue;
+		}
+
+		// Upload the values collected so far first, as this parameter could modify the value indices (multiparms)
+		UploadValueBatch();
+
 		bool bSuccess = false;
 
 		if (CurrentParm->IsPendingRevertToDefault())
@@ -2119,6 +2924,8 @@ FHoudiniParameterTranslator::UploadChangedParameters( UHoudiniAssetComponent * H
 		}
 	}
 
+	UploadValueBatch();
+
 	FHoudiniParameterTranslator::RevertRampParameters(RampsToRevert, HAC->GetAssetId());
 
 	return true;
@@ -2608,22 +3415,27 @@ bool FHoudiniParameterTranslator::UploadRampParameter(UHoudiniParameter* InParam
 	}
 
 	int32 InsertIndex = InsertIndexStart;
-
+	for (auto& Event : *Events)
+	{
+		if (Event && Event->IsInsertEvent())
+			InsertIndex += 1;
+	}
 
 	// Step 2:  Handle all insert events
-	for (auto& Event : *Events) 
+	// The points are all appended to the ramp, so simply set its new instance count
+	if (InsertIndex > InsertIndexStart)
 	{
-		if (!Event)
-			continue;
-
-		if (!Event->IsInsertEvent())
-			continue;
-		
-		FHoudiniApi::InsertMultiparmInstance(
+		if (MultiParam->GetValueIndex() < 0 || HAPI_RESULT_SUCCESS != FHoudiniApi::SetParmIntValues(
 			FHoudiniEngine::Get().GetSession(), MultiParam->GetNodeId(),
-			MultiParam->GetParmId(), InsertIndex + MultiParam->InstanceStartOffset);
-
-		InsertIndex += 1;
+			&InsertIndex, MultiParam->GetValueIndex(), 1))
+		{
+			for (int32 Index = InsertIndexStart; Index < InsertIndex; Index++)
+			{
+				FHoudiniApi::InsertMultiparmInstance(
+					FHoudiniEngine::Get().GetSession(), MultiParam->GetNodeId(),
+					MultiParam->GetParmId(), Index + MultiParam->InstanceStartOffset);
+			}
+		}
 	}
 	
 	// Step 3:  Set inserted parameter values (only if there are instances inserted)
@@ -2655,7 +3467,9 @@ bool FHoudiniParameterTranslator::UploadRampParameter(UHoudiniParameter* InParam
 
 			// Starting index of parameters which just inserted
 			Idx += 3 * InsertIndexStart;
-			
+
+			// The inserted points' values are mostly contiguous, upload them together
+			FHoudiniParameterValueBatch ValueBatch;
 
 			for (auto & Event : *Events)
 			{
@@ -2665,35 +3479,32 @@ bool FHoudiniParameterTranslator::UploadRampParameter(UHoudiniParameter* InParam
 				if (!Event->IsInsertEvent())
 					continue;
 
+				if (!ParmInfos.IsValidIndex(Idx + 2))
+					break;
+
 				// 1: update position float at param Idx
-				FHoudiniApi::SetParmFloatValues(
-					FHoudiniEngine::Get().GetSession(),
-					AssetInfo.nodeId, &(Event->InsertPosition), ParmInfos[Idx].floatValuesIndex, 1);
+				ValueBatch.AddFloatValues(AssetInfo.nodeId, &(Event->InsertPosition), ParmInfos[Idx].floatValuesIndex, 1);
 
 				// step 2: update value at param Idx + 1
 				if (Event->IsFloatRampEvent())
 				{
 					// float value
-					FHoudiniApi::SetParmFloatValues(
-						FHoudiniEngine::Get().GetSession(),
-						AssetInfo.nodeId, &(Event->InsertFloat), ParmInfos[Idx + 1].floatValuesIndex, 1);
+					ValueBatch.AddFloatValues(AssetInfo.nodeId, &(Event->InsertFloat), ParmInfos[Idx + 1].floatValuesIndex, 1);
 				}
 				else
 				{
 					// color value
-					FHoudiniApi::SetParmFloatValues(
-						FHoudiniEngine::Get().GetSession(),
-						AssetInfo.nodeId, (float*)(&Event->InsertColor.R), ParmInfos[Idx + 1].floatValuesIndex, 3);
+					ValueBatch.AddFloatValues(AssetInfo.nodeId, (float*)(&Event->InsertColor.R), ParmInfos[Idx + 1].floatValuesIndex, 3);
 				}
 
 				// step 3: update interpolation type at param Idx + 2
 				int32 IntValue = (int32)(Event->InsertInterpolation);
-				FHoudiniApi::SetParmIntValues(
-					FHoudiniEngine::Get().GetSession(),
-					AssetInfo.nodeId, &IntValue, ParmInfos[Idx + 2].intValuesIndex, 1);
+				ValueBatch.AddIntValues(AssetInfo.nodeId, &IntValue, ParmInfos[Idx + 2].intValuesIndex, 1);
 				
 				Idx += 3;
 			}
+
+			ValueBatch.Upload();
 		}
 	}
 
@@ -2713,26 +3524,58 @@ bool FHoudiniParameterTranslator::UploadMultiParmValues(UHoudiniParameter* InPar
 
 	int32 Size = MultiParam->MultiParmInstanceLastModifyArray.Num();
 
+	// Count the modifications, and check if they are all at the end of the instance list
+	int32 NumInserted = 0;
+	int32 NumRemoved = 0;
+	int32 FirstModifiedIndex = Size;
 	for (int32 Index = 0; Index < Size; ++Index)
 	{
+		if (LastModificationArray[Index] == EHoudiniMultiParmModificationType::None)
+			continue;
+
 		if (LastModificationArray[Index] == EHoudiniMultiParmModificationType::Inserted)
-		{
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::InsertMultiparmInstance(
-				FHoudiniEngine::Get().GetSession(), MultiParam->GetNodeId(),
-				MultiParam->GetParmId(), Index + MultiParam->InstanceStartOffset))
-				return false;	
-			
-		}
+			NumInserted++;
+		else if (LastModificationArray[Index] == EHoudiniMultiParmModificationType::Removed)
+			NumRemoved++;
+
+		FirstModifiedIndex = FMath::Min(FirstModifiedIndex, Index);
 	}
 
-	for (int32 Index = Size - 1; Index >= 0; --Index)
+	// Instances only appended or only removed from the end can be handled by setting the instance count
+	bool bResized = false;
+	if ((NumInserted > 0) != (NumRemoved > 0)
+		&& FirstModifiedIndex + NumInserted + NumRemoved == Size
+		&& MultiParam->GetValueIndex() >= 0)
 	{
-		if (LastModificationArray[Index] == EHoudiniMultiParmModificationType::Removed)
+		int32 NewInstanceCount = Size - NumRemoved;
+		bResized = HAPI_RESULT_SUCCESS == FHoudiniApi::SetParmIntValues(
+			FHoudiniEngine::Get().GetSession(), MultiParam->GetNodeId(),
+			&NewInstanceCount, MultiParam->GetValueIndex(), 1);
+	}
+
+	if (!bResized)
+	{
+		for (int32 Index = 0; Index < Size; ++Index)
 		{
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::RemoveMultiparmInstance(
-				FHoudiniEngine::Get().GetSession(), MultiParam->GetNodeId(),
-				MultiParam->GetParmId(), Index + MultiParam->InstanceStartOffset))
-				return false;
+			if (LastModificationArray[Index] == EHoudiniMultiParmModificationType::Inserted)
+			{
+				if (HAPI_RESULT_SUCCESS != FHoudiniApi::InsertMultiparmInstance(
+					FHoudiniEngine::Get().GetSession(), MultiParam->GetNodeId(),
+					MultiParam->GetParmId(), Index + MultiParam->InstanceStartOffset))
+					return false;	
+				
+			}
+		}
+
+		for (int32 Index = Size - 1; Index >= 0; --Index)
+		{
+			if (LastModificationArray[Index] == EHoudiniMultiParmModificationType::Removed)
+			{
+				if (HAPI_RESULT_SUCCESS != FHoudiniApi::RemoveMultiparmInstance(
+					FHoudiniEngine::Get().GetSession(), MultiParam->GetNodeId(),
+					MultiParam->GetParmId(), Index + MultiParam->InstanceStartOffset))
+					return false;
+			}
 		}
 	}
 
@@ -35,6 +35,18 @@ class UHoudiniParameterFile;
 enum class EHoudiniFolderParameterType : uint8;
 enum class EHoudiniParameterType : uint8;
 
+// Values of all the parameters of a node, fetched in bulk by BuildAllParameters
+// so updating the parameters doesn't require HAPI calls for each of them
+struct HOUDINIENGINE_API FHoudiniParameterNodeValues
+{
+	TArray<int32> IntValues;
+	TArray<float> FloatValues;
+	TArray<FString> StringValues;
+
+	// Identifies the node's asset definition, used to cache the parameters tags
+	FString AssetDefinitionKey;
+};
+
 struct HOUDINIENGINE_API FHoudiniParameterTranslator
 {
 	// 
@@ -42,6 +54,19 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 
 	static bool OnPreCookParameters(UHoudiniAssetComponent* HAC);
 
+	// Keep a copy of the HAC's parameters on its Houdini Asset, so that new instances of the asset
+	// can be initialized without having to build their whole parameter interface
+	static bool CacheParameterTemplates(UHoudiniAssetComponent* HAC);
+
+	// Initialize the parameters of a newly instantiated HAC using its Houdini Asset's parameter templates
+	static bool InitializeParametersFromTemplates(UHoudiniAssetComponent* HAC);
+
+	// Duplicate parameters to a new outer, the duplicates reference each other instead of the source parameters
+	static bool DuplicateParameters(
+		const TArray<UHoudiniParameter*>& InParameters,
+		UObject* InOuter,
+		TArray<UHoudiniParameter*>& OutParameters);
+
 	//
 	static bool UpdateLoadedParameters(UHoudiniAssetComponent* HAC);
 
@@ -98,12 +123,43 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 	// and set to true when creating a new parameter
 	// bUpdateValue should be set to false when updating loaded parameters
 	// as the internal parameter's value from HAPI
+	// InNodeValues can be used to provide the node's values fetched by HapiGetNodeParameterValues
 	static bool UpdateParameterFromInfo(
 		UHoudiniParameter * HoudiniParameter,
 		const HAPI_NodeId& InNodeId,
 		const HAPI_ParmInfo& ParmInfo,
 		const bool& bFullUpdate = true,
-		const bool& bUpdateValue = true);
+		const bool& bUpdateValue = true,
+		const FHoudiniParameterNodeValues* InNodeValues = nullptr);
+
+	// HAPI: Get the int, float and string values of all the parameters of a node
+	static bool HapiGetNodeParameterValues(
+		const HAPI_NodeId& InNodeId,
+		const HAPI_NodeInfo& InNodeInfo,
+		FHoudiniParameterNodeValues& OutNodeValues);
+
+	// Get a parameter's values, from the node's values if provided, or from HAPI
+	static bool GetParmIntValues(
+		const HAPI_NodeId& InNodeId, const FHoudiniParameterNodeValues* InNodeValues,
+		int32* OutValues, const int32& InStart, const int32& InCount);
+	static bool GetParmFloatValues(
+		const HAPI_NodeId& InNodeId, const FHoudiniParameterNodeValues* InNodeValues,
+		float* OutValues, const int32& InStart, const int32& InCount);
+	static bool GetParmStringValues(
+		const HAPI_NodeId& InNodeId, const FHoudiniParameterNodeValues* InNodeValues,
+		TArray<FString>& OutValues, const int32& InStart, const int32& InCount);
+
+	// HAPI: Get all the tags of a parameter.
+	// Tags don't change between cooks, so they are cached per asset definition if InAssetDefinitionKey is set.
+	static bool HapiGetParameterTags(
+		const HAPI_NodeId& InNodeId,
+		const HAPI_ParmInfo& InParmInfo,
+		const FString& InParmName,
+		const FString& InAssetDefinitionKey,
+		TMap<FString, FString>& OutTags);
+
+	// Forgets the cached parameter tags, needed when asset definitions are reloaded
+	static void ClearParameterTagsCache();
 
 	static UClass* GetDesiredParameterClass(const HAPI_ParmInfo& ParmInfo);
 
@@ -134,6 +190,9 @@ struct HOUDINIENGINE_API FHoudiniParameterTranslator
 		const HAPI_ParmId& ParmId,
 		FString& OutUnitString );
 
+	// Converts the value of a parameter's unit tag to a unit string unreal can parse
+	static FString ConvertParameterUnitTag(const FString& InUnitTag);
+
 	// HAPI: Indicates if a parameter has a given tag
 	static bool HapiGetParameterHasTag(
 		const HAPI_NodeId& NodeId,
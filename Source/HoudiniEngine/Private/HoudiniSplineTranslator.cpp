@@ -970,6 +970,222 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 	return true;
 }
 
+bool
+FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataAsGeometry(
+	HAPI_NodeId& CurveNodeId,
+	const FString& InputNodeName,
+	const TArray<FVector>* Positions,
+	const TArray<FQuat>* Rotations,
+	const TArray<FVector>* Scales3d,
+	EHoudiniCurveType InCurveType,
+	const bool& InClosed,
+	const bool& InReversed)
+{
+#if WITH_EDITOR
+	// Positions are required
+	if (!Positions)
+		return false;
+
+	const int32 NumberOfCVs = Positions->Num();
+	if (NumberOfCVs < 2)
+		return false;
+
+	// Rotations and scales are only sent if we have one per point
+	const bool bAddRotations = Rotations && (Rotations->Num() == NumberOfCVs);
+	const bool bAddScales3d = Scales3d && (Scales3d->Num() == NumberOfCVs);
+
+	// If the previous node was a curve SOP (created by HapiCreateCurveInputNodeForData),
+	// it can't receive geometry, so we need to replace it with an input node
+	if (CurveNodeId >= 0)
+	{
+		HAPI_ParmId CoordsParmId = -1;
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(CurveNodeId))
+		{
+			CurveNodeId = -1;
+		}
+		else if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetParmIdFromName(
+			FHoudiniEngine::Get().GetSession(), CurveNodeId, HAPI_UNREAL_PARAM_CURVE_COORDS, &CoordsParmId)
+			&& CoordsParmId >= 0)
+		{
+			HAPI_NodeId PreviousObjNodeId = FHoudiniEngineUtils::HapiGetParentNodeId(CurveNodeId);
+			FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), CurveNodeId);
+			if (PreviousObjNodeId >= 0)
+				FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), PreviousObjNodeId);
+
+			CurveNodeId = -1;
+		}
+	}
+
+	if (CurveNodeId < 0)
+	{
+		HAPI_NodeId NodeId = -1;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
+			FHoudiniEngine::Get().GetSession(), &NodeId, TCHAR_TO_UTF8(*InputNodeName)), false);
+
+		if (!FHoudiniEngineUtils::HapiCookNode(NodeId, nullptr, true))
+			return false;
+
+		// Check if we have a valid id for this new input node.
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(NodeId))
+			return false;
+
+		CurveNodeId = NodeId;
+	}
+
+	// Linear curves have an order of 2, NURBS use cubic (order 4) CVs.
+	const HAPI_CurveType HapiCurveType = (InCurveType == EHoudiniCurveType::Nurbs) ? HAPI_CURVETYPE_NURBS : HAPI_CURVETYPE_LINEAR;
+	const int32 CurveOrder = (HapiCurveType == HAPI_CURVETYPE_NURBS) ? 4 : 2;
+
+	// Create the curve part
+	HAPI_PartInfo Part;
+	FHoudiniApi::PartInfo_Init(&Part);
+	Part.id = 0;
+	Part.nameSH = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_POINT] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_PRIM] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_VERTEX] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_DETAIL] = 0;
+	Part.pointCount = NumberOfCVs;
+	Part.vertexCount = NumberOfCVs;
+	Part.faceCount = 1;
+	Part.type = HAPI_PARTTYPE_CURVE;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+		FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &Part), false);
+
+	HAPI_CurveInfo CurveInfo;
+	FHoudiniApi::CurveInfo_Init(&CurveInfo);
+	CurveInfo.curveType = HapiCurveType;
+	CurveInfo.curveCount = 1;
+	CurveInfo.vertexCount = NumberOfCVs;
+	CurveInfo.knotCount = 0;
+	CurveInfo.isPeriodic = InClosed;
+	CurveInfo.isRational = false;
+	CurveInfo.order = CurveOrder;
+	CurveInfo.hasKnots = false;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveInfo(
+		FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &CurveInfo), false);
+
+	int32 CurveCount = NumberOfCVs;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveCounts(
+		FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &CurveCount, 0, 1), false);
+
+	// Reversing the curve only changes the order of the points
+	auto GetSourceIndex = [&](const int32& Idx)
+	{
+		return InReversed ? NumberOfCVs - 1 - Idx : Idx;
+	};
+
+	// Create the POSITION attribute
+	{
+		HAPI_AttributeInfo AttributeInfoPosition;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoPosition);
+		AttributeInfoPosition.count = NumberOfCVs;
+		AttributeInfoPosition.tupleSize = 3;
+		AttributeInfoPosition.exists = true;
+		AttributeInfoPosition.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfoPosition.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoPosition.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+			HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPosition), false);
+
+		// Convert to meters and swap Y/Z
+		TArray<float> CurvePositions;
+		CurvePositions.SetNumUninitialized(NumberOfCVs * 3);
+		for (int32 Idx = 0; Idx < NumberOfCVs; ++Idx)
+		{
+			const FVector& Position = (*Positions)[GetSourceIndex(Idx)];
+			CurvePositions[Idx * 3 + 0] = Position.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			CurvePositions[Idx * 3 + 1] = Position.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+			CurvePositions[Idx * 3 + 2] = Position.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		}
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+			HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPosition,
+			CurvePositions.GetData(), 0, AttributeInfoPosition.count), false);
+	}
+
+	// Create the ROTATION attribute
+	if (bAddRotations)
+	{
+		HAPI_AttributeInfo AttributeInfoRotation;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoRotation);
+		AttributeInfoRotation.count = NumberOfCVs;
+		AttributeInfoRotation.tupleSize = 4;
+		AttributeInfoRotation.exists = true;
+		AttributeInfoRotation.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfoRotation.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoRotation.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+			HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoRotation), false);
+
+		TArray<float> CurveRotations;
+		CurveRotations.SetNumUninitialized(NumberOfCVs * 4);
+		for (int32 Idx = 0; Idx < NumberOfCVs; ++Idx)
+		{
+			const FQuat& RotationQuaternion = (*Rotations)[GetSourceIndex(Idx)];
+			CurveRotations[Idx * 4 + 0] = RotationQuaternion.X;
+			CurveRotations[Idx * 4 + 1] = RotationQuaternion.Z;
+			CurveRotations[Idx * 4 + 2] = RotationQuaternion.Y;
+			CurveRotations[Idx * 4 + 3] = -RotationQuaternion.W;
+		}
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+			HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoRotation,
+			CurveRotations.GetData(), 0, AttributeInfoRotation.count), false);
+	}
+
+	// Create the SCALE attribute
+	if (bAddScales3d)
+	{
+		HAPI_AttributeInfo AttributeInfoScale;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoScale);
+		AttributeInfoScale.count = NumberOfCVs;
+		AttributeInfoScale.tupleSize = 3;
+		AttributeInfoScale.exists = true;
+		AttributeInfoScale.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfoScale.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoScale.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+			HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale), false);
+
+		TArray<float> CurveScales;
+		CurveScales.SetNumUninitialized(NumberOfCVs * 3);
+		for (int32 Idx = 0; Idx < NumberOfCVs; ++Idx)
+		{
+			const FVector& ScaleVector = (*Scales3d)[GetSourceIndex(Idx)];
+			CurveScales[Idx * 3 + 0] = ScaleVector.X;
+			CurveScales[Idx * 3 + 1] = ScaleVector.Z;
+			CurveScales[Idx * 3 + 2] = ScaleVector.Y;
+		}
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+			HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale,
+			CurveScales.GetData(), 0, AttributeInfoScale.count), false);
+	}
+
+	// Commit the geo
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		FHoudiniEngine::Get().GetSession(), CurveNodeId), false);
+
+	// Cook the node, no need to wait for completion
+	if (!FHoudiniEngineUtils::HapiCookNode(CurveNodeId, nullptr, false))
+		return false;
+#endif
+
+	return true;
+}
+
 void
 FHoudiniSplineTranslator::CreatePositionsString(const TArray<FVector>& InPositions, FString& OutPositionString)
 {
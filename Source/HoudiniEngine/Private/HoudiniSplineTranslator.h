@@ -77,6 +77,19 @@ struct HOUDINIENGINE_API FHoudiniSplineTranslator
 		const bool& InForceClose = false,
 		const FTransform& ParentTransform = FTransform::Identity);
 
+	// Update the curve input node data, or create a new input node if the CurveNodeId is invalid.
+	// Unlike HapiCreateCurveInputNodeForData, the points are uploaded directly as float P/rot/scale
+	// attributes on a curve part, without being formatted to (and parsed back from) a string parm.
+	static bool HapiCreateCurveInputNodeForDataAsGeometry(
+		HAPI_NodeId& CurveNodeId,
+		const FString& InputNodeName,
+		const TArray<FVector>* Positions,
+		const TArray<FQuat>* Rotations,
+		const TArray<FVector>* Scales3d,
+		EHoudiniCurveType InCurveType,
+		const bool& InClosed,
+		const bool& InReversed);
+
 	// Create a default curve node.
 	static bool HapiCreateCurveInputNode(
 		HAPI_NodeId& OutCurveNodeId, const FString& InputNodeName);
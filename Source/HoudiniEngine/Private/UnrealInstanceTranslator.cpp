@@ -86,38 +86,128 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 
 	// MARSHALL THE INSTANCE TRANSFORM
 	{
-		// Get the instance transform and convert them to Position/Rotation/Scale array
-		TArray<float> Positions;
-		Positions.SetNumZeroed(InstanceCount * 3);
-		TArray<float> Rotations;
-		Rotations.SetNumZeroed(InstanceCount * 4);
-		TArray<float> Scales;
-		Scales.SetNumZeroed(InstanceCount * 3);
+		// Get the instance transforms
+		TArray<FTransform> InstanceTransforms;
+		InstanceTransforms.SetNum(InstanceCount);
 		for (int32 InstanceIdx = 0; InstanceIdx < InstanceCount; InstanceIdx++)
-		{
-			FTransform CurTransform;
-			ISMC->GetInstanceTransform(InstanceIdx, CurTransform);
-
-			// Convert Unreal Position to Houdini
-			FVector PositionVector = CurTransform.GetLocation();
-			Positions[InstanceIdx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Positions[InstanceIdx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Positions[InstanceIdx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-
-			// Convert Unreal Rotation to Houdini
-			FQuat RotationQuaternion = CurTransform.GetRotation();
-			Rotations[InstanceIdx * 4 + 0] = RotationQuaternion.X;
-			Rotations[InstanceIdx * 4 + 1] = RotationQuaternion.Z;
-			Rotations[InstanceIdx * 4 + 2] = RotationQuaternion.Y;
-			Rotations[InstanceIdx * 4 + 3] = -RotationQuaternion.W;
-
-			// Convert Unreal Scale to Houdini
-			FVector ScaleVector = CurTransform.GetScale3D();
-			Scales[InstanceIdx * 3 + 0] = ScaleVector.X;
-			Scales[InstanceIdx * 3 + 1] = ScaleVector.Z;
-			Scales[InstanceIdx * 3 + 2] = ScaleVector.Y;
-		}
+			ISMC->GetInstanceTransform(InstanceIdx, InstanceTransforms[InstanceIdx]);
 
+		// Send all the instances as a single point cloud
+		if (!HapiSetInstancesPointData(InstancesNodeId, InstanceTransforms, 0, InstanceCount, true))
+			return false;
+	}
+		
+	// Connect the mesh to the copytopoints node's second input
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
+		FHoudiniEngine::Get().GetSession(), CopyNodeId, 0, SMNodeId, 0), false);
+
+	// Connect the instances to the copytopoints node's second input
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
+		FHoudiniEngine::Get().GetSession(), CopyNodeId, 1, InstancesNodeId, 0), false);
+
+	// Update this input object's node IDs
+	OutCreatedNodeId = CopyNodeId;
+
+	return true;
+}
+
+bool
+FUnrealInstanceTranslator::HapiUpdateInstancerTransforms(
+	UInstancedStaticMeshComponent* ISMC,
+	const HAPI_NodeId& InCopyNodeId,
+	const TArray<FTransform>& InPreviousTransforms)
+{
+	if (!ISMC || ISMC->IsPendingKill())
+		return false;
+
+	// The instances point cloud is plugged in the copytopoints second input
+	HAPI_NodeId InstancesNodeId = -1;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::QueryNodeInput(
+		FHoudiniEngine::Get().GetSession(), InCopyNodeId, 1, &InstancesNodeId))
+		return false;
+
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(InstancesNodeId))
+		return false;
+
+	int32 InstanceCount = ISMC->GetInstanceCount();
+	TArray<FTransform> InstanceTransforms;
+	InstanceTransforms.SetNum(InstanceCount);
+	for (int32 InstanceIdx = 0; InstanceIdx < InstanceCount; InstanceIdx++)
+		ISMC->GetInstanceTransform(InstanceIdx, InstanceTransforms[InstanceIdx]);
+
+	// If the number of instances has changed, we need to resize the point cloud and send all the points
+	if (InstanceCount != InPreviousTransforms.Num())
+		return HapiSetInstancesPointData(InstancesNodeId, InstanceTransforms, 0, InstanceCount, true);
+
+	// Find the range of instances that have been modified since the last upload
+	int32 FirstChanged = INDEX_NONE;
+	int32 LastChanged = INDEX_NONE;
+	for (int32 InstanceIdx = 0; InstanceIdx < InstanceCount; InstanceIdx++)
+	{
+		if (InstanceTransforms[InstanceIdx].Equals(InPreviousTransforms[InstanceIdx]))
+			continue;
+
+		if (FirstChanged == INDEX_NONE)
+			FirstChanged = InstanceIdx;
+		LastChanged = InstanceIdx;
+	}
+
+	// Nothing to update
+	if (FirstChanged == INDEX_NONE)
+		return true;
+
+	// Only send the modified range, if that fails, try to resend all the points
+	if (HapiSetInstancesPointData(InstancesNodeId, InstanceTransforms, FirstChanged, LastChanged - FirstChanged + 1, false))
+		return true;
+
+	return HapiSetInstancesPointData(InstancesNodeId, InstanceTransforms, 0, InstanceCount, true);
+}
+
+bool
+FUnrealInstanceTranslator::HapiSetInstancesPointData(
+	const HAPI_NodeId& InInstancesNodeId,
+	const TArray<FTransform>& InTransforms,
+	const int32& InStart,
+	const int32& InCount,
+	const bool& bCreatePart)
+{
+	const int32 InstanceCount = InTransforms.Num();
+	if (InStart < 0 || InCount < 0 || (InStart + InCount) > InstanceCount)
+		return false;
+
+	// Get the instance transform and convert them to Position/Rotation/Scale array
+	TArray<float> Positions;
+	Positions.SetNumUninitialized(InCount * 3);
+	TArray<float> Rotations;
+	Rotations.SetNumUninitialized(InCount * 4);
+	TArray<float> Scales;
+	Scales.SetNumUninitialized(InCount * 3);
+	for (int32 Idx = 0; Idx < InCount; Idx++)
+	{
+		const FTransform& CurTransform = InTransforms[InStart + Idx];
+
+		// Convert Unreal Position to Houdini
+		FVector PositionVector = CurTransform.GetLocation();
+		Positions[Idx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		Positions[Idx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		Positions[Idx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+
+		// Convert Unreal Rotation to Houdini
+		FQuat RotationQuaternion = CurTransform.GetRotation();
+		Rotations[Idx * 4 + 0] = RotationQuaternion.X;
+		Rotations[Idx * 4 + 1] = RotationQuaternion.Z;
+		Rotations[Idx * 4 + 2] = RotationQuaternion.Y;
+		Rotations[Idx * 4 + 3] = -RotationQuaternion.W;
+
+		// Convert Unreal Scale to Houdini
+		FVector ScaleVector = CurTransform.GetScale3D();
+		Scales[Idx * 3 + 0] = ScaleVector.X;
+		Scales[Idx * 3 + 1] = ScaleVector.Z;
+		Scales[Idx * 3 + 2] = ScaleVector.Y;
+	}
+
+	if (bCreatePart)
+	{
 		// Create a part for the instance points.
 		HAPI_PartInfo Part;
 		FHoudiniApi::PartInfo_Init(&Part);
@@ -132,81 +222,76 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 		Part.pointCount = InstanceCount;
 		Part.type = HAPI_PARTTYPE_MESH;
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
-			FHoudiniEngine::Get().GetSession(), InstancesNodeId, 0, &Part), false);
-
-		// Create position (P) attribute
-		HAPI_AttributeInfo AttributeInfoPoint;
-		FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
-		AttributeInfoPoint.count = InstanceCount;
-		AttributeInfoPoint.tupleSize = 3;
-		AttributeInfoPoint.exists = true;
-		AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
-		AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
-		AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+			FHoudiniEngine::Get().GetSession(), InInstancesNodeId, 0, &Part), false);
+	}
 
+	// Position (P) attribute
+	HAPI_AttributeInfo AttributeInfoPoint;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
+	AttributeInfoPoint.count = InstanceCount;
+	AttributeInfoPoint.tupleSize = 3;
+	AttributeInfoPoint.exists = true;
+	AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+	AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+	AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	// Rotation (rot) attribute
+	HAPI_AttributeInfo AttributeInfoRotation;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoRotation);
+	AttributeInfoRotation.count = InstanceCount;
+	AttributeInfoRotation.tupleSize = 4;
+	AttributeInfoRotation.exists = true;
+	AttributeInfoRotation.owner = HAPI_ATTROWNER_POINT;
+	AttributeInfoRotation.storage = HAPI_STORAGETYPE_FLOAT;
+	AttributeInfoRotation.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	// Scale attribute
+	HAPI_AttributeInfo AttributeInfoScale;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoScale);
+	AttributeInfoScale.count = InstanceCount;
+	AttributeInfoScale.tupleSize = 3;
+	AttributeInfoScale.exists = true;
+	AttributeInfoScale.owner = HAPI_ATTROWNER_POINT;
+	AttributeInfoScale.storage = HAPI_STORAGETYPE_FLOAT;
+	AttributeInfoScale.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	// The attributes only need to be added when (re)creating the part
+	if (bCreatePart)
+	{
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
 			FHoudiniEngine::Get().GetSession(),
-			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
+			InInstancesNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
 
-		// Now that we have raw positions, we can upload them for our attribute.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
 			FHoudiniEngine::Get().GetSession(),
-			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
-			Positions.GetData(), 0, AttributeInfoPoint.count), false);
-
-		// Create Rotation (rot) attribute
-		HAPI_AttributeInfo AttributeInfoRotation;
-		FHoudiniApi::AttributeInfo_Init(&AttributeInfoRotation);
-		AttributeInfoRotation.count = InstanceCount;
-		AttributeInfoRotation.tupleSize = 4;
-		AttributeInfoRotation.exists = true;
-		AttributeInfoRotation.owner = HAPI_ATTROWNER_POINT;
-		AttributeInfoRotation.storage = HAPI_STORAGETYPE_FLOAT;
-		AttributeInfoRotation.originalOwner = HAPI_ATTROWNER_INVALID;
+			InInstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoRotation), false);
 
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
 			FHoudiniEngine::Get().GetSession(),
-			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoRotation), false);
+			InInstancesNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale), false);
+	}
 
+	if (InCount > 0)
+	{
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
 			FHoudiniEngine::Get().GetSession(),
-			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoRotation,
-			Rotations.GetData(), 0, AttributeInfoRotation.count), false);
-
-		// Create scale attribute
-		HAPI_AttributeInfo AttributeInfoScale;
-		FHoudiniApi::AttributeInfo_Init(&AttributeInfoScale);
-		AttributeInfoScale.count = InstanceCount;
-		AttributeInfoScale.tupleSize = 3;
-		AttributeInfoScale.exists = true;
-		AttributeInfoScale.owner = HAPI_ATTROWNER_POINT;
-		AttributeInfoScale.storage = HAPI_STORAGETYPE_FLOAT;
-		AttributeInfoScale.originalOwner = HAPI_ATTROWNER_INVALID;
+			InInstancesNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+			Positions.GetData(), InStart, InCount), false);
 
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
 			FHoudiniEngine::Get().GetSession(),
-			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale), false);
+			InInstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoRotation,
+			Rotations.GetData(), InStart, InCount), false);
 
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
 			FHoudiniEngine::Get().GetSession(),
-			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale,
-			Scales.GetData(), 0, AttributeInfoScale.count), false);
-
-		// Commit the instance point geo.
-		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
-			FHoudiniEngine::Get().GetSession(), InstancesNodeId), false);
+			InInstancesNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale,
+			Scales.GetData(), InStart, InCount), false);
 	}
-		
-	// Connect the mesh to the copytopoints node's second input
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
-		FHoudiniEngine::Get().GetSession(), CopyNodeId, 0, SMNodeId, 0), false);
-
-	// Connect the instances to the copytopoints node's second input
-	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::ConnectNodeInput(
-		FHoudiniEngine::Get().GetSession(), CopyNodeId, 1, InstancesNodeId, 0), false);
 
-	// Update this input object's node IDs
-	OutCreatedNodeId = CopyNodeId;
+	// Commit the instance point geo.
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		FHoudiniEngine::Get().GetSession(), InInstancesNodeId), false);
 
 	return true;
-}
\ No newline at end of file
+}
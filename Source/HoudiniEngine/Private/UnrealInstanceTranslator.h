@@ -46,4 +46,21 @@ struct HOUDINIENGINE_API FUnrealInstanceTranslator
 			const bool& bExportSockets,
 			const bool& bExportColliders,
 			const bool& bExportAsAttributeInstancer);
+
+		// HAPI : Only update the instance points of a previously created instancer input node.
+		// InCopyNodeId is the copytopoints node returned by HapiCreateInputNodeForInstancer.
+		// Only the range of instances that differ from InPreviousTransforms is sent, unless the instance count changed.
+		static bool HapiUpdateInstancerTransforms(
+			UInstancedStaticMeshComponent* ISMC,
+			const HAPI_NodeId& InCopyNodeId,
+			const TArray<FTransform>& InPreviousTransforms);
+
+		// HAPI : Set the P/rot/scale point attributes for InCount instances starting at InStart.
+		// If bCreatePart is true, the part and its attributes are (re)created to fit all the transforms.
+		static bool HapiSetInstancesPointData(
+			const HAPI_NodeId& InInstancesNodeId,
+			const TArray<FTransform>& InTransforms,
+			const int32& InStart,
+			const int32& InCount,
+			const bool& bCreatePart);
 };
\ No newline at end of file
@@ -33,6 +33,7 @@
 
 #include "UnrealLandscapeTranslator.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniInputObject.h"
 
 #include "Landscape.h"
 #include "LandscapeDataAccess.h"
@@ -40,8 +41,35 @@
 #include "LightMap.h"
 #include "Engine/MapBuildDataRegistry.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Async/Async.h"
 
 
+// Data of a landscape layer exported to a heightfield volume.
+// The layer is extracted on the game thread, and then converted to float on a worker thread.
+struct FHoudiniLandscapeLayerExportData
+{
+	FHoudiniLandscapeLayerExportData()
+	{
+		FHoudiniApi::VolumeInfo_Init(&VolumeInfo);
+	}
+
+	~FHoudiniLandscapeLayerExportData()
+	{
+		// Never release the data while it's still being converted
+		if (ConversionResult.IsValid())
+			ConversionResult.Wait();
+	}
+
+	int32 LayerIndex = INDEX_NONE;
+	FString LayerName;
+	FLinearColor LayerUsageDebugColor;
+	TArray<uint8> IntData;
+
+	TArray<float> FloatData;
+	HAPI_VolumeInfo VolumeInfo;
+	TFuture<bool> ConversionResult;
+};
+
 bool 
 FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 	ALandscapeProxy* LandscapeProxy, 
@@ -273,7 +301,10 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 
 bool 
 FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
-	ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId, const FString& InputNodeNameStr) 
+	ALandscapeProxy* LandscapeProxy,
+	HAPI_NodeId& CreatedHeightfieldNodeId,
+	const FString& InputNodeNameStr,
+	FHoudiniLandscapeHeightfieldCache* OutHeightfieldCache)
 {
 	if (!LandscapeProxy)
 		return false;
@@ -292,15 +323,20 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	//--------------------------------------------------------------------------------------------------
 	// 2. Convert the height uint16 data to float
 	//--------------------------------------------------------------------------------------------------
+	// The conversion only works on the extracted data, so it can run in the background
+	// while we create the heightfield nodes in Houdini.
 	TArray<float> HeightfieldFloatValues;
 	HAPI_VolumeInfo HeightfieldVolumeInfo;
 	FHoudiniApi::VolumeInfo_Init(&HeightfieldVolumeInfo);
 	FTransform LandscapeTransform = LandscapeProxy->ActorToWorld();
 	FVector CenterOffset = FVector::ZeroVector;
-	if (!ConvertLandscapeDataToHeightfieldData(
-		HeightData, XSize, YSize, Min, Max, LandscapeTransform,
-		HeightfieldFloatValues, HeightfieldVolumeInfo, CenterOffset))
-		return false;
+	TFuture<bool> HeightConversion = Async(EAsyncExecution::ThreadPool,
+		[&HeightData, XSize, YSize, Min, Max, LandscapeTransform, &HeightfieldFloatValues, &HeightfieldVolumeInfo, &CenterOffset]()
+		{
+			return ConvertLandscapeDataToHeightfieldData(
+				HeightData, XSize, YSize, Min, Max, LandscapeTransform,
+				HeightfieldFloatValues, HeightfieldVolumeInfo, CenterOffset);
+		});
 
 	//--------------------------------------------------------------------------------------------------
 	// 3. Create the Heightfield Input Node
@@ -309,9 +345,29 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	HAPI_NodeId HeightId = -1;
 	HAPI_NodeId MaskId = -1;
 	HAPI_NodeId MergeId = -1;
-	if (!CreateHeightfieldInputNode(InputNodeNameStr, XSize, YSize, HeightFieldId, HeightId, MaskId, MergeId))
+	bool bNodeCreated = CreateHeightfieldInputNode(InputNodeNameStr, XSize, YSize, HeightFieldId, HeightId, MaskId, MergeId);
+
+	// The height data is used by the conversion, always wait for it to be done
+	if (!HeightConversion.Get() || !bNodeCreated)
 		return false;
 
+	// Keep track of the created nodes and of the exported data so the next export can be incremental
+	if (OutHeightfieldCache)
+	{
+		OutHeightfieldCache->Reset();
+		OutHeightfieldCache->HeightfieldNodeId = HeightFieldId;
+		OutHeightfieldCache->HeightVolumeNodeId = HeightId;
+		OutHeightfieldCache->MaskVolumeNodeId = MaskId;
+		GetLandscapeProxyExtent(
+			LandscapeProxy,
+			OutHeightfieldCache->MinX, OutHeightfieldCache->MinY,
+			OutHeightfieldCache->MaxX, OutHeightfieldCache->MaxY);
+		OutHeightfieldCache->ComponentSizeQuads = LandscapeProxy->ComponentSizeQuads;
+		OutHeightfieldCache->LandscapeTransform = LandscapeTransform;
+		ComputeLandscapeComponentHashes(
+			HeightData, XSize, YSize, LandscapeProxy->ComponentSizeQuads, OutHeightfieldCache->HeightComponentHashes);
+	}
+
 	//--------------------------------------------------------------------------------------------------
 	// 4. Set the HeightfieldData in Houdini
 	//--------------------------------------------------------------------------------------------------    
@@ -362,32 +418,19 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 	bool MaskInitialized = false;
 	int32 MergeInputIndex = 2;
-	int32 NumLayers = LandscapeInfo->Layers.Num();
-	for (int32 n = 0; n < NumLayers; n++)
-	{
-		// 1. Extract the uint8 values from the layer
-		TArray<uint8> CurrentLayerIntData;
-		FLinearColor LayerUsageDebugColor;
-		FString LayerName;
-		if (!GetLandscapeLayerData(LandscapeInfo, n, CurrentLayerIntData, LayerUsageDebugColor, LayerName))
-			continue;
 
-		// 2. Convert unreal uint8 values to floats
-		// If the layer came from Houdini, additional info might have been stored in the DebugColor to convert the data back to float
-		HAPI_VolumeInfo CurrentLayerVolumeInfo;
-		FHoudiniApi::VolumeInfo_Init(&CurrentLayerVolumeInfo);
-		TArray<float> CurrentLayerFloatData;
-		if (!ConvertLandscapeLayerDataToHeightfieldData(
-			CurrentLayerIntData, XSize, YSize, LayerUsageDebugColor,
-			CurrentLayerFloatData, CurrentLayerVolumeInfo))
-			continue;
+	// Uploads a converted layer to Houdini, only returns false on HAPI errors
+	auto UploadLayer = [&](FHoudiniLandscapeLayerExportData& Layer) -> bool
+	{
+		if (!Layer.ConversionResult.Get())
+			return true;
 
 		// We reuse the height layer's transform
-		CurrentLayerVolumeInfo.transform = HeightfieldVolumeInfo.transform;
+		Layer.VolumeInfo.transform = HeightfieldVolumeInfo.transform;
 
 		// 3. See if we need to create an input volume, or can reuse the HF's default mask volume
 		bool IsMask = false;
-		if (LayerName.Equals(TEXT("mask"), ESearchCase::IgnoreCase))
+		if (Layer.LayerName.Equals(TEXT("mask"), ESearchCase::IgnoreCase))
 			IsMask = true;
 
 		HAPI_NodeId LayerVolumeNodeId = -1;
@@ -395,7 +438,7 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		{
 			// Current layer is not mask, so we need to create a new input volume
 			std::string LayerNameStr;
-			FHoudiniEngineUtils::ConvertUnrealString(LayerName, LayerNameStr);
+			FHoudiniEngineUtils::ConvertUnrealString(Layer.LayerName, LayerNameStr);
 
 			FHoudiniApi::CreateHeightfieldInputVolumeNode(
 				FHoudiniEngine::Get().GetSession(),
@@ -409,17 +452,16 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 		// Check if we have a valid id for the input volume.
 		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(LayerVolumeNodeId))
-			continue;
+			return true;
 
 		// 4. Set the layer/mask heighfield data in Houdini
-		HAPI_PartId CurrentPartId = 0;
-		if (!SetHeighfieldData(LayerVolumeNodeId, PartId, CurrentLayerFloatData, CurrentLayerVolumeInfo, LayerName))
-			continue;
+		if (!SetHeighfieldData(LayerVolumeNodeId, PartId, Layer.FloatData, Layer.VolumeInfo, Layer.LayerName))
+			return true;
 
 		// Get the physical material used by that layer
 		UPhysicalMaterial* LayerPhysicalMat = LandscapePhysMat;
 		{
-			FLandscapeInfoLayerSettings LayersSetting = LandscapeInfo->Layers[n];
+			FLandscapeInfoLayerSettings LayersSetting = LandscapeInfo->Layers[Layer.LayerIndex];
 			ULandscapeLayerInfoObject* LayerInfo = LayersSetting.LayerInfoObj;
 			if (LayerInfo)
 				LayerPhysicalMat = LayerInfo->PhysMaterial;
@@ -455,6 +497,60 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		{
 			MaskInitialized = true;
 		}
+
+		if (OutHeightfieldCache)
+		{
+			OutHeightfieldCache->LayerVolumeNodeIds.Add(Layer.LayerName, LayerVolumeNodeId);
+			ComputeLandscapeComponentHashes(
+				Layer.IntData, XSize, YSize, LandscapeProxy->ComponentSizeQuads,
+				OutHeightfieldCache->LayerComponentHashes.FindOrAdd(Layer.LayerName));
+		}
+
+		return true;
+	};
+
+	// The layers are pipelined: while a layer is converted to float in the background,
+	// the game thread extracts the next layer and uploads the previous one to Houdini.
+	// This way, only two layers are kept in memory at a time.
+	TUniquePtr<FHoudiniLandscapeLayerExportData> PendingLayer;
+	int32 NumLayers = LandscapeInfo->Layers.Num();
+	for (int32 n = 0; n <= NumLayers; n++)
+	{
+		TUniquePtr<FHoudiniLandscapeLayerExportData> CurrentLayer;
+		if (n < NumLayers)
+		{
+			// 1. Extract the uint8 values from the layer
+			CurrentLayer = MakeUnique<FHoudiniLandscapeLayerExportData>();
+			CurrentLayer->LayerIndex = n;
+			if (GetLandscapeLayerData(LandscapeInfo, n, CurrentLayer->IntData, CurrentLayer->LayerUsageDebugColor, CurrentLayer->LayerName))
+			{
+				if (OutHeightfieldCache)
+					OutHeightfieldCache->ExportedLayerNames.Add(CurrentLayer->LayerName);
+
+				// 2. Convert unreal uint8 values to floats
+				// If the layer came from Houdini, additional info might have been stored in the DebugColor to convert the data back to float
+				FHoudiniLandscapeLayerExportData* Layer = CurrentLayer.Get();
+				Layer->ConversionResult = Async(EAsyncExecution::ThreadPool, [Layer, XSize, YSize]()
+				{
+					return ConvertLandscapeLayerDataToHeightfieldData(
+						Layer->IntData, XSize, YSize, Layer->LayerUsageDebugColor,
+						Layer->FloatData, Layer->VolumeInfo);
+				});
+			}
+			else
+			{
+				CurrentLayer.Reset();
+			}
+		}
+
+		// Upload the previous layer while the current one is being converted
+		if (PendingLayer.IsValid())
+		{
+			if (!UploadLayer(*PendingLayer))
+				return false;
+		}
+
+		PendingLayer = MoveTemp(CurrentLayer);
 	}
 
 	// We need to have a mask layer as it is required for proper heightfield functionalities
@@ -511,6 +607,253 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(
+	ALandscapeProxy* LandscapeProxy,
+	const HAPI_NodeId& HeightfieldNodeId,
+	FHoudiniLandscapeHeightfieldCache& InOutHeightfieldCache)
+{
+	if (!LandscapeProxy)
+		return false;
+
+	// Make sure the previously exported heightfield is still the one used by the input
+	if (HeightfieldNodeId < 0 || HeightfieldNodeId != InOutHeightfieldCache.HeightfieldNodeId)
+		return false;
+
+	if (!FHoudiniEngineUtils::IsHoudiniNodeValid(InOutHeightfieldCache.HeightfieldNodeId)
+		|| !FHoudiniEngineUtils::IsHoudiniNodeValid(InOutHeightfieldCache.HeightVolumeNodeId)
+		|| !FHoudiniEngineUtils::IsHoudiniNodeValid(InOutHeightfieldCache.MaskVolumeNodeId))
+		return false;
+
+	// The landscape extents, component size and transform must be unchanged,
+	// as they define the heightfield's resolution and the conversion of the height values
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
+		return false;
+
+	if (MinX != InOutHeightfieldCache.MinX || MinY != InOutHeightfieldCache.MinY
+		|| MaxX != InOutHeightfieldCache.MaxX || MaxY != InOutHeightfieldCache.MaxY)
+		return false;
+
+	if (LandscapeProxy->ComponentSizeQuads != InOutHeightfieldCache.ComponentSizeQuads)
+		return false;
+
+	FTransform LandscapeTransform = LandscapeProxy->ActorToWorld();
+	if (!LandscapeTransform.Equals(InOutHeightfieldCache.LandscapeTransform))
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	const int32 ComponentSizeQuads = InOutHeightfieldCache.ComponentSizeQuads;
+	HAPI_PartId PartId = 0;
+	bool bNeedsCook = false;
+
+	//--------------------------------------------------------------------------------------------------
+	// 1. Height: only send the rows covered by the modified components
+	//--------------------------------------------------------------------------------------------------
+	TArray<uint16> HeightData;
+	int32 XSize, YSize;
+	FVector Min, Max;
+	if (!GetLandscapeData(LandscapeProxy, HeightData, XSize, YSize, Min, Max))
+		return false;
+
+	TArray<uint32> HeightHashes;
+	ComputeLandscapeComponentHashes(HeightData, XSize, YSize, ComponentSizeQuads, HeightHashes);
+
+	TArray<FIntPoint> ModifiedRanges;
+	if (!GetModifiedLandscapeXRanges(
+		InOutHeightfieldCache.HeightComponentHashes, HeightHashes, XSize, ComponentSizeQuads, ModifiedRanges))
+		return false;
+
+	if (ModifiedRanges.Num() > 0)
+	{
+		TArray<float> HeightfieldFloatValues;
+		HAPI_VolumeInfo HeightfieldVolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&HeightfieldVolumeInfo);
+		FVector CenterOffset = FVector::ZeroVector;
+		if (!ConvertLandscapeDataToHeightfieldData(
+			HeightData, XSize, YSize, Min, Max, LandscapeTransform,
+			HeightfieldFloatValues, HeightfieldVolumeInfo, CenterOffset))
+			return false;
+
+		if (!SetHeighfieldDataRanges(
+			InOutHeightfieldCache.HeightVolumeNodeId, PartId, HeightfieldFloatValues, ModifiedRanges, YSize, TEXT("height")))
+			return false;
+
+		InOutHeightfieldCache.HeightComponentHashes = HeightHashes;
+		bNeedsCook = true;
+	}
+
+	//--------------------------------------------------------------------------------------------------
+	// 2. Layers: skip the unchanged ones, and only send the modified rows of the others
+	//--------------------------------------------------------------------------------------------------
+	int32 NumLayers = LandscapeInfo->Layers.Num();
+
+	// Any layer added, removed or reordered since the last export requires a full export,
+	// as the layer volumes connected to the heightfield's merge node need to be rebuilt
+	TArray<FString> CurrentLayerNames;
+	for (int32 n = 0; n < NumLayers; n++)
+	{
+		if (LandscapeInfo->Layers[n].LayerInfoObj)
+			CurrentLayerNames.Add(LandscapeInfo->Layers[n].GetLayerName().ToString());
+	}
+
+	if (CurrentLayerNames != InOutHeightfieldCache.ExportedLayerNames)
+		return false;
+
+	for (int32 n = 0; n < NumLayers; n++)
+	{
+		TArray<uint8> CurrentLayerIntData;
+		FLinearColor LayerUsageDebugColor;
+		FString LayerName;
+		if (!GetLandscapeLayerData(LandscapeInfo, n, CurrentLayerIntData, LayerUsageDebugColor, LayerName))
+			continue;
+
+		// Layers that weren't exported by the full export are ignored here as well
+		if (CurrentLayerIntData.Num() != XSize * YSize)
+			continue;
+
+		// Layers that failed to upload during the last export were skipped by it, skip them as well
+		int32* LayerVolumeNodeIdPtr = InOutHeightfieldCache.LayerVolumeNodeIds.Find(LayerName);
+		TArray<uint32>* PreviousLayerHashesPtr = InOutHeightfieldCache.LayerComponentHashes.Find(LayerName);
+		if (!LayerVolumeNodeIdPtr || !PreviousLayerHashesPtr)
+			continue;
+
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(*LayerVolumeNodeIdPtr))
+			return false;
+
+		TArray<uint32> LayerHashes;
+		ComputeLandscapeComponentHashes(CurrentLayerIntData, XSize, YSize, ComponentSizeQuads, LayerHashes);
+
+		TArray<FIntPoint> ModifiedLayerRanges;
+		if (!GetModifiedLandscapeXRanges(*PreviousLayerHashesPtr, LayerHashes, XSize, ComponentSizeQuads, ModifiedLayerRanges))
+			return false;
+
+		// This layer hasn't changed, keep the previously uploaded data
+		if (ModifiedLayerRanges.Num() <= 0)
+			continue;
+
+		// Layers that came from Houdini are converted using their global min/max,
+		// so a local modification can change all of their values: resend them entirely.
+		if (LayerUsageDebugColor.A == PI)
+		{
+			ModifiedLayerRanges.Empty();
+			ModifiedLayerRanges.Add(FIntPoint(0, XSize - 1));
+		}
+
+		HAPI_VolumeInfo CurrentLayerVolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&CurrentLayerVolumeInfo);
+		TArray<float> CurrentLayerFloatData;
+		if (!ConvertLandscapeLayerDataToHeightfieldData(
+			CurrentLayerIntData, XSize, YSize, LayerUsageDebugColor,
+			CurrentLayerFloatData, CurrentLayerVolumeInfo))
+			continue;
+
+		if (!SetHeighfieldDataRanges(
+			*LayerVolumeNodeIdPtr, PartId, CurrentLayerFloatData, ModifiedLayerRanges, YSize, LayerName))
+			return false;
+
+		*PreviousLayerHashesPtr = LayerHashes;
+		bNeedsCook = true;
+	}
+
+	// Nothing has changed, no need to cook
+	if (!bNeedsCook)
+		return true;
+
+	return FHoudiniEngineUtils::HapiCookNode(InOutHeightfieldCache.HeightfieldNodeId, nullptr, true);
+}
+
+bool
+FUnrealLandscapeTranslator::GetModifiedLandscapeXRanges(
+	const TArray<uint32>& PreviousHashes,
+	const TArray<uint32>& NewHashes,
+	const int32& XSize,
+	const int32& ComponentSizeQuads,
+	TArray<FIntPoint>& OutModifiedRanges)
+{
+	OutModifiedRanges.Empty();
+	if (ComponentSizeQuads <= 0 || XSize < 2)
+		return false;
+
+	// The component layout must match to compare the hashes
+	if (PreviousHashes.Num() != NewHashes.Num() || NewHashes.Num() <= 0)
+		return false;
+
+	const int32 NumComponentsX = FMath::DivideAndRoundUp(XSize - 1, ComponentSizeQuads);
+	const int32 NumComponentsY = NewHashes.Num() / NumComponentsX;
+
+	// Heightfields are transposed: a landscape X coordinate is a heightfield row,
+	// so a modified component requires all the rows (X) it covers to be sent.
+	int32 RangeStartCompX = INDEX_NONE;
+	for (int32 CompX = 0; CompX <= NumComponentsX; CompX++)
+	{
+		bool bColumnModified = false;
+		if (CompX < NumComponentsX)
+		{
+			for (int32 CompY = 0; CompY < NumComponentsY; CompY++)
+			{
+				const int32 HashIdx = CompX + CompY * NumComponentsX;
+				if (PreviousHashes[HashIdx] != NewHashes[HashIdx])
+				{
+					bColumnModified = true;
+					break;
+				}
+			}
+		}
+
+		if (bColumnModified && RangeStartCompX == INDEX_NONE)
+		{
+			RangeStartCompX = CompX;
+		}
+		else if (!bColumnModified && RangeStartCompX != INDEX_NONE)
+		{
+			// Close the current range of modified columns
+			const int32 X0 = RangeStartCompX * ComponentSizeQuads;
+			const int32 X1 = FMath::Min(CompX * ComponentSizeQuads, XSize - 1);
+			OutModifiedRanges.Add(FIntPoint(X0, X1));
+			RangeStartCompX = INDEX_NONE;
+		}
+	}
+
+	return true;
+}
+
+bool
+FUnrealLandscapeTranslator::SetHeighfieldDataRanges(
+	const HAPI_NodeId& VolumeNodeId,
+	const HAPI_PartId& PartId,
+	const TArray<float>& FloatValues,
+	const TArray<FIntPoint>& RowRanges,
+	const int32& RowLength,
+	const FString& HeightfieldName)
+{
+	// Volume name
+	std::string NameStr;
+	FHoudiniEngineUtils::ConvertUnrealString(HeightfieldName, NameStr);
+
+	for (const FIntPoint& CurrentRange : RowRanges)
+	{
+		const int32 Start = CurrentRange.X * RowLength;
+		const int32 Length = (CurrentRange.Y - CurrentRange.X + 1) * RowLength;
+		if (Start < 0 || Length <= 0 || (Start + Length) > FloatValues.Num())
+			return false;
+
+		// Only set the data for the modified rows
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetHeightFieldData(
+			FHoudiniEngine::Get().GetSession(),
+			VolumeNodeId, PartId, NameStr.c_str(), FloatValues.GetData() + Start, Start, Length), false);
+	}
+
+	// Commit the volume's geo
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		FHoudiniEngine::Get().GetSession(), VolumeNodeId), false);
+
+	return true;
+}
+
 // Converts Unreal uint16 values to Houdini Float
 bool
 FUnrealLandscapeTranslator::ConvertLandscapeLayerDataToHeightfieldData(
@@ -574,20 +917,16 @@ FUnrealLandscapeTranslator::ConvertLandscapeLayerDataToHeightfieldData(
 	// Convert the Int data to Float
 	LayerFloatValues.SetNumUninitialized(SizeInPoints);
 
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
+	// We need to invert X/Y when reading the value from Unreal
+	const double DoubleIntMin = (double)IntMin;
+	FHoudiniEngineUtils::TransposeAndConvertData(
+		IntHeightData.GetData(), LayerFloatValues.GetData(), HoudiniXSize, HoudiniYSize,
+		[DoubleIntMin, LayerSpacing, LayerMin](const uint8& IntValue)
 		{
-			// We need to invert X/Y when reading the value from Unreal
-			int32 nHoudini = nX + nY * HoudiniXSize;
-			int32 nUnreal = nY + nX * XSize;
-
-			// Convert the int values to meter
-			// Unreal's digit value have a zero value of 32768
-			double DoubleValue = ((double)IntHeightData[nUnreal] - (double)IntMin) * LayerSpacing + LayerMin;
-			LayerFloatValues[nHoudini] = (float)DoubleValue;
-		}
-	}
+			// Convert the int values to the layer's range
+			double DoubleValue = ((double)IntValue - DoubleIntMin) * LayerSpacing + LayerMin;
+			return (float)DoubleValue;
+		});
 
 	/*
 	// Verifying the converted ZMin / ZMax
@@ -641,17 +980,9 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 		return false;
 
 	// Get the landscape extents to get its size
-	int32 MinX = MAX_int32;
-	int32 MinY = MAX_int32;
-	int32 MaxX = -MAX_int32;
-	int32 MaxY = -MAX_int32;
-
-	// To handle streaming proxies correctly, get the extents via all the components,
-	// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
-	for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
-	{
-		Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
-	}
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
+		return false;
 
 	if (!GetLandscapeData(LandscapeInfo, MinX, MinY, MaxX, MaxY, HeightData, XSize, YSize))
 		return false;
@@ -696,6 +1027,30 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 }
 
 
+bool
+FUnrealLandscapeTranslator::GetLandscapeProxyExtent(
+	ALandscapeProxy* LandscapeProxy,
+	int32& MinX, int32& MinY,
+	int32& MaxX, int32& MaxY)
+{
+	MinX = MAX_int32;
+	MinY = MAX_int32;
+	MaxX = -MAX_int32;
+	MaxY = -MAX_int32;
+
+	if (!LandscapeProxy)
+		return false;
+
+	// To handle streaming proxies correctly, get the extents via all the components,
+	// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
+	for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
+	{
+		Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
+	}
+
+	return (MinX <= MaxX) && (MinY <= MaxY);
+}
+
 void
 FUnrealLandscapeTranslator::GetLandscapeProxyBounds(
 	ALandscapeProxy* LandscapeProxy, FVector& Origin, FVector& Extents)
@@ -764,20 +1119,16 @@ FUnrealLandscapeTranslator::ConvertLandscapeDataToHeightfieldData(
 	// Convert the Int data to Float
 	HeightfieldFloatValues.SetNumUninitialized(SizeInPoints);
 
-	for (int32 nY = 0; nY < HoudiniYSize; nY++)
-	{
-		for (int32 nX = 0; nX < HoudiniXSize; nX++)
+	// We need to invert X/Y when reading the value from Unreal
+	FHoudiniEngineUtils::TransposeAndConvertData(
+		IntHeightData.GetData(), HeightfieldFloatValues.GetData(), HoudiniXSize, HoudiniYSize,
+		[ZCenterOffset, ZSpacing, ZPositionOffset](const uint16& IntValue)
 		{
-			// We need to invert X/Y when reading the value from Unreal
-			int32 nHoudini = nX + nY * HoudiniXSize;
-			int32 nUnreal = nY + nX * XSize;
-
 			// Convert the int values to meter
 			// Unreal's digit value have a zero value of 32768
-			double DoubleValue = ((double)IntHeightData[nUnreal] - ZCenterOffset) * ZSpacing + ZPositionOffset;
-			HeightfieldFloatValues[nHoudini] = (float)DoubleValue;
-		}
-	}
+			double DoubleValue = ((double)IntValue - ZCenterOffset) * ZSpacing + ZPositionOffset;
+			return (float)DoubleValue;
+		});
 
 	//--------------------------------------------------------------------------------------------------
 	// 2. Convert the Unreal Transform to a HAPI_transform
@@ -32,6 +32,8 @@
 class ALandscapeProxy;
 class UHoudiniInputLandscape;
 
+struct FHoudiniLandscapeHeightfieldCache;
+
 struct HOUDINIENGINE_API FUnrealLandscapeTranslator 
 {
 	public:
@@ -42,7 +44,60 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 		static bool CreateHeightfieldFromLandscape(
 			ALandscapeProxy* LandcapeProxy, 
 			HAPI_NodeId& CreatedHeightfieldNodeId,
-			const FString &InputNodeNameStr);
+			const FString &InputNodeNameStr,
+			FHoudiniLandscapeHeightfieldCache* OutHeightfieldCache = nullptr);
+
+		// Update a heightfield previously created by CreateHeightfieldFromLandscape by only sending
+		// the layers and rows of landscape components that were modified since the last export.
+		// Returns false if the heightfield can't be updated incrementally and needs to be recreated.
+		static bool UpdateHeightfieldFromLandscape(
+			ALandscapeProxy* LandscapeProxy,
+			const HAPI_NodeId& HeightfieldNodeId,
+			FHoudiniLandscapeHeightfieldCache& InOutHeightfieldCache);
+
+		// Computes a hash of each landscape component's data in a uint16/uint8 landscape data array
+		template<typename TDataType>
+		static void ComputeLandscapeComponentHashes(
+			const TArray<TDataType>& InData,
+			const int32& XSize,
+			const int32& YSize,
+			const int32& ComponentSizeQuads,
+			TArray<uint32>& OutHashes)
+		{
+			OutHashes.Empty();
+			if (ComponentSizeQuads <= 0 || XSize < 2 || YSize < 2 || InData.Num() != XSize * YSize)
+				return;
+
+			const int32 NumComponentsX = FMath::DivideAndRoundUp(XSize - 1, ComponentSizeQuads);
+			const int32 NumComponentsY = FMath::DivideAndRoundUp(YSize - 1, ComponentSizeQuads);
+			OutHashes.SetNumZeroed(NumComponentsX * NumComponentsY);
+
+			for (int32 CompY = 0; CompY < NumComponentsY; CompY++)
+			{
+				const int32 Y0 = CompY * ComponentSizeQuads;
+				const int32 Y1 = FMath::Min(Y0 + ComponentSizeQuads, YSize - 1);
+				for (int32 CompX = 0; CompX < NumComponentsX; CompX++)
+				{
+					const int32 X0 = CompX * ComponentSizeQuads;
+					const int32 X1 = FMath::Min(X0 + ComponentSizeQuads, XSize - 1);
+
+					// Unreal's data is stored row by row (X first), hash each row of the component
+					uint32 Hash = 0;
+					for (int32 Y = Y0; Y <= Y1; Y++)
+						Hash = FCrc::MemCrc32(&InData[X0 + Y * XSize], (X1 - X0 + 1) * sizeof(TDataType), Hash);
+
+					OutHashes[CompX + CompY * NumComponentsX] = Hash;
+				}
+			}
+		}
+
+		// Get the ranges of landscape X coordinates covered by components whose hash has changed
+		static bool GetModifiedLandscapeXRanges(
+			const TArray<uint32>& PreviousHashes,
+			const TArray<uint32>& NewHashes,
+			const int32& XSize,
+			const int32& ComponentSizeQuads,
+			TArray<FIntPoint>& OutModifiedRanges);
 
 		// Extracts the uint16 values of a given landscape
 		static bool GetLandscapeData(
@@ -60,6 +115,12 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			TArray<uint16>& HeightData,
 			int32& XSize, int32& YSize);
 
+		// Get the extents of a landscape proxy, in landscape quads, from its components
+		static bool GetLandscapeProxyExtent(
+			ALandscapeProxy* LandscapeProxy,
+			int32& MinX, int32& MinY,
+			int32& MaxX, int32& MaxY);
+
 		static void GetLandscapeProxyBounds(
 			ALandscapeProxy* LandscapeProxy,
 			FVector& Origin, FVector& Extents);
@@ -102,6 +163,15 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 			const HAPI_VolumeInfo& VolumeInfo,
 			const FString& HeightfieldName);
 
+		// Set the volume float values of a heightfield for the given ranges of rows only
+		static bool SetHeighfieldDataRanges(
+			const HAPI_NodeId& VolumeNodeId,
+			const HAPI_PartId& PartId,
+			const TArray<float>& FloatValues,
+			const TArray<FIntPoint>& RowRanges,
+			const int32& RowLength,
+			const FString& HeightfieldName);
+
 		static bool AddLandscapeMaterialAttributesToVolume(
 			const HAPI_NodeId& VolumeNodeId,
 			const HAPI_PartId& PartId,
@@ -83,9 +83,10 @@ FUnrealSplineTranslator::CreateInputNodeForSplineComponent(USplineComponent* Spl
 	}
 
 
-	if (!FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(CreatedInputNodeId, NodeName,
+	// Send the points directly as geometry instead of going through the curve SOP's coords string
+	if (!FHoudiniSplineTranslator::HapiCreateCurveInputNodeForDataAsGeometry(CreatedInputNodeId, NodeName,
 		&RefinedSplinePositions, &RefinedSplineRotations, &RefinedSplineScales,
-		EHoudiniCurveType::Polygon, EHoudiniCurveMethod::Breakpoints, false, SplineComponent->IsClosedLoop()))
+		EHoudiniCurveType::Polygon, false, SplineComponent->IsClosedLoop()))
 		return false;
 
 	// Add spline component tags if it has any
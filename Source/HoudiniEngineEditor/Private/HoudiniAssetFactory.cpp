@@ -28,6 +28,8 @@
 
 #include "HoudiniEngineEditorPrivatePCH.h"
 #include "HoudiniAsset.h"
+#include "HoudiniParameterTranslator.h"
+#include "HoudiniMaterialTranslator.h"
 
 #include "EditorFramework/AssetImportData.h"
 #include "Misc/FileHelper.h"
@@ -193,6 +195,11 @@ UHoudiniAssetFactory::Reimport(UObject * Obj)
 		{
 			HOUDINI_LOG_MESSAGE(TEXT("Houdini Asset reimported successfully."));
 
+			// The asset's parameters may have changed, don't reuse their cached tags
+			FHoudiniParameterTranslator::ClearParameterTagsCache();
+			// Nor the material instances shared by its outputs
+			FHoudiniMaterialTranslator::ClearMaterialInstanceCache();
+
 			if (HoudiniAsset->GetOuter())
 				HoudiniAsset->GetOuter()->MarkPackageDirty();
 			else
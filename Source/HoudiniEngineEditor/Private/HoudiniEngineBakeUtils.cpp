@@ -857,7 +857,8 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_ISMC(
 
 	// Instancer name adds the split identifier (INSTANCERNUM_VARIATIONNUM)
 	const FString BaseName = OwnerActor->GetName();
-	const FString InstancerName = ObjectName + "_instancer_" + InOutputObjectIdentifier.SplitIdentifier;
+	// Instancers split in cells are baked with their variation's name, so the names don't depend on the cells
+	const FString InstancerName = ObjectName + "_instancer_" + FHoudiniInstanceTranslator::GetVariationSplitIdentifier(InOutputObjectIdentifier.SplitIdentifier);
 	const FName WorldOutlinerFolderPath = GetOutlinerFolderPath(InOutputObject, FName(InFallbackWorldOutlinerFolder.IsEmpty() ? BaseName : InFallbackWorldOutlinerFolder));
 
 	// See if the instanced static mesh is still a temporary Houdini created Static Mesh
@@ -1153,7 +1154,8 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_SMC(
 	// BaseName holds the Actor / HDA name
 	// Instancer name adds the split identifier (INSTANCERNUM_VARIATIONNUM)
 	const FString BaseName = OwnerActor->GetName();
-	const FString InstancerName = ObjectName + "_instancer_" + InOutputObjectIdentifier.SplitIdentifier;
+	// Instancers split in cells are baked with their variation's name, so the names don't depend on the cells
+	const FString InstancerName = ObjectName + "_instancer_" + FHoudiniInstanceTranslator::GetVariationSplitIdentifier(InOutputObjectIdentifier.SplitIdentifier);
 	const FName WorldOutlinerFolderPath = GetOutlinerFolderPath(InOutputObject, FName(InFallbackWorldOutlinerFolder.IsEmpty() ? BaseName : InFallbackWorldOutlinerFolder));
 
 	// See if the instanced static mesh is still a temporary Houdini created Static Mesh
@@ -1331,6 +1333,9 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 	if (!InIAC || InIAC->IsPendingKill())
 		return false;
 
+	// Spawn the actors that are still pending so that all the instances get baked
+	FHoudiniInstanceTranslator::FlushPendingInstanceActorSpawns(InIAC);
+
 	AActor * OwnerActor = InIAC->GetOwner();
 	if (!OwnerActor || OwnerActor->IsPendingKill())
 		return false;
@@ -50,6 +50,8 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniPDGAssetLink.h"
 #include "HoudiniPackageParams.h"
+#include "HoudiniInstanceTranslator.h"
+#include "HoudiniInstancedActorComponent.h"
 
 #include "Modules/ModuleManager.h"
 #include "Interfaces/IPluginManager.h"
@@ -1212,6 +1214,15 @@ FHoudiniEngineEditor::RegisterEditorDelegates()
 
 		if (!World->IsGameWorld())
 		{
+			// Spawn the instanced actors still waiting for their spawn, and destroy the unused pooled actors so they aren't saved
+			FHoudiniInstanceTranslator::FlushPendingInstanceActorSpawns();
+			for (TObjectIterator<UHoudiniInstancedActorComponent> Itr; Itr; ++Itr)
+			{
+				UHoudiniInstancedActorComponent* IAC = *Itr;
+				if (IAC && !IAC->IsPendingKill() && IAC->GetWorld() == World)
+					IAC->ClearPooledActors();
+			}
+
 			UWorld * const OnPreSaveWorld = World;
 
 			FDelegateHandle& OnPostSaveWorldHandle = FHoudiniEngineEditor::Get().GetOnPostSaveWorldOnceHandle();
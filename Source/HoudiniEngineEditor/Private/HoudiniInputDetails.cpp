@@ -2709,7 +2709,7 @@ FHoudiniInputDetails::AddLandscapeInputUI(TSharedRef<SVerticalBox> VerticalBox,
 
 				if (bNewState)
 				{
-					// We want to update this landscape data directly, start by backing it up to image files in the temp folder
+					// We want to update this landscape data directly, start by backing it up to a cache file in the temp folder
 					FString BackupBaseName = HAC->TemporaryCookFolder.Path
 						+ TEXT("/")
 						+ CurrentInputLandscapeProxy->GetName()
@@ -2717,7 +2717,8 @@ FHoudiniInputDetails::AddLandscapeInputUI(TSharedRef<SVerticalBox> VerticalBox,
 						+ HAC->GetComponentGUID().ToString().Left(FHoudiniEngineUtils::PackageGUIDComponentNameLength);
 
 					// We need to cache the input landscape to a file
-					FHoudiniLandscapeTranslator::BackupLandscapeToImageFiles(BackupBaseName, CurrentInputLandscapeProxy);
+					FHoudiniLandscapeTranslator::BackupLandscapeToCacheFile(
+						BackupBaseName, CurrentInputLandscapeProxy, CurrentInputLandscape->BackupCacheFile);
 					
 					// Cache its transform on the input
 					CurrentInputLandscape->CachedInputLandscapeTraqnsform = CurrentInputLandscapeProxy->ActorToWorld();
@@ -2731,7 +2732,9 @@ FHoudiniInputDetails::AddLandscapeInputUI(TSharedRef<SVerticalBox> VerticalBox,
 					CurrentInputLandscapeProxy->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
 
 					// Restore the input landscape's backup data
-					FHoudiniLandscapeTranslator::RestoreLandscapeFromImageFiles(CurrentInputLandscapeProxy);
+					FHoudiniLandscapeTranslator::RestoreLandscapeFromCacheFile(
+						CurrentInputLandscapeProxy, CurrentInputLandscape->BackupCacheFile);
+					CurrentInputLandscape->BackupCacheFile.Empty();
 
 					// Reapply the source Landscape's transform
 					CurrentInputLandscapeProxy->SetActorTransform(CurrentInputLandscape->CachedInputLandscapeTraqnsform);
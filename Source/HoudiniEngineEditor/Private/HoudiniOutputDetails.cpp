@@ -2542,6 +2542,24 @@ FHoudiniOutputDetails::CreateInstancerOutputWidget(
 				FHoudiniOutputObjectIdentifier CurVariationIdentifier = CurOutputObjectIdentifier;
 				CurVariationIdentifier.SplitIdentifier += TEXT("_") + FString::FromInt(VariationIdx);
 				const FHoudiniOutputObject* VariationOutputObject = OutputObjects.Find(CurVariationIdentifier);
+				if (!VariationOutputObject)
+				{
+					// The variation may have been split in cells, use the component of its first cell
+					for (const auto& CurOutputObjectPair : OutputObjects)
+					{
+						const FHoudiniOutputObjectIdentifier& CurIdentifier = CurOutputObjectPair.Key;
+						if (CurIdentifier.ObjectId == CurVariationIdentifier.ObjectId
+							&& CurIdentifier.GeoId == CurVariationIdentifier.GeoId
+							&& CurIdentifier.PartId == CurVariationIdentifier.PartId
+							&& CurIdentifier.SplitIdentifier != CurVariationIdentifier.SplitIdentifier
+							&& FHoudiniInstanceTranslator::GetVariationSplitIdentifier(CurIdentifier.SplitIdentifier) == CurVariationIdentifier.SplitIdentifier)
+						{
+							VariationOutputObject = &CurOutputObjectPair.Value;
+							break;
+						}
+					}
+				}
+
 				if(VariationOutputObject)
 					InstancerType = FHoudiniInstanceTranslator::GetInstancerTypeFromComponent(VariationOutputObject->OutputComponent);
 
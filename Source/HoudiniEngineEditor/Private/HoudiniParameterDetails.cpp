@@ -46,6 +46,7 @@
 #include "HoudiniParameterOperatorPath.h"
 #include "HoudiniInput.h"
 #include "HoudiniAsset.h"
+#include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
@@ -2342,6 +2343,9 @@ FHoudiniParameterDetails::CreateNestedRow(IDetailCategoryBuilder & HouParameterC
 	{
 		int32 ParentMultiParmId = MainParam->GetParentParmId();
 
+		// Parameter used to identify the multiparm instance the current parameter belongs to
+		UHoudiniParameter* InstanceParam = MainParam;
+
 		// If this is a folder param, its folder list parent parm is the multiparm
 		if (MainParam->GetParameterType() == EHoudiniParameterType::Folder) 
 		{
@@ -2353,6 +2357,7 @@ FHoudiniParameterDetails::CreateNestedRow(IDetailCategoryBuilder & HouParameterC
 				return nullptr;			// This should not happen
 
 			ParentMultiParmId = ParentFolderList->GetParentParmId();
+			InstanceParam = ParentFolderList;
 		}
 
 		if (!AllMultiParms.Contains(ParentMultiParmId)) // This should not happen normally
@@ -2361,8 +2366,8 @@ FHoudiniParameterDetails::CreateNestedRow(IDetailCategoryBuilder & HouParameterC
 		// Get the parent multiparm
 		UHoudiniParameterMultiParm* ParentMultiParm = AllMultiParms[ParentMultiParmId];
 
-		// The parent multiparm is visible.
-		if (ParentMultiParm && ParentMultiParm->IsShown() && MainParam->ShouldDisplay())
+		// The parent multiparm is visible, and so is the instance.
+		if (ParentMultiParm && ParentMultiParm->IsShown() && MainParam->ShouldDisplay() && IsMultiParmInstanceDisplayed(ParentMultiParm, InstanceParam))
 		{
 			if (MainParam->GetParameterType() != EHoudiniParameterType::FolderList)
 				Row = &(HouParameterCategory.AddCustomRow(FText::GetEmpty()));
@@ -2454,6 +2459,27 @@ FHoudiniParameterDetails::CreateNestedRow(IDetailCategoryBuilder & HouParameterC
 	return Row;
 }
 
+bool
+FHoudiniParameterDetails::IsMultiParmInstanceDisplayed(const UHoudiniParameterMultiParm* InMultiParm, const UHoudiniParameter* InInstanceParam) const
+{
+	if (!InMultiParm || InMultiParm->IsPendingKill() || !InInstanceParam || InInstanceParam->IsPendingKill())
+		return false;
+
+	if (InMultiParm->IsShowingAllInstances())
+		return true;
+
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (!HoudiniRuntimeSettings || HoudiniRuntimeSettings->MaxDisplayedMultiParmInstances <= 0)
+		return true;
+
+	// Parameters that haven't been updated since their instance number was recorded are always displayed
+	if (InInstanceParam->GetInstanceNum() < 0)
+		return true;
+
+	const int32 InstanceIndex = InInstanceParam->GetInstanceNum() - (int32)InMultiParm->InstanceStartOffset;
+	return InstanceIndex < HoudiniRuntimeSettings->MaxDisplayedMultiParmInstances;
+}
+
 void
 FHoudiniParameterDetails::HandleUnsupportedParmType(IDetailCategoryBuilder & HouParameterCategory, TArray<UHoudiniParameter*> &InParams)
 {
@@ -3213,7 +3239,7 @@ FHoudiniParameterDetails::CreateWidgetString( IDetailCategoryBuilder & HouParame
 					[
 						SAssignNew(MultiLineEditableTextBox, SMultiLineEditableTextBox)
 						.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
-						.Text(FText::FromString(MainParam->GetValueAt(Idx)))
+						.Text_Lambda([MainParam, Idx]() { return FText::FromString(MainParam->GetValueAt(Idx)); })
 						.OnTextCommitted_Lambda([=](const FText& Val, ETextCommit::Type TextCommitType) { ChangeStringValueAt(Val.ToString(), nullptr, Idx, true, StringParams); })
 					]
 					+ SHorizontalBox::Slot()
@@ -3268,7 +3294,7 @@ FHoudiniParameterDetails::CreateWidgetString( IDetailCategoryBuilder & HouParame
 					[
 						SAssignNew(EditableTextBox, SEditableTextBox)
 						.Font(FEditorStyle::GetFontStyle(TEXT("PropertyWindow.NormalFont")))
-						.Text(FText::FromString(MainParam->GetValueAt(Idx)))
+						.Text_Lambda([MainParam, Idx]() { return FText::FromString(MainParam->GetValueAt(Idx)); })
 						.OnTextCommitted_Lambda([=](const FText& Val, ETextCommit::Type TextCommitType) 
 							{ ChangeStringValueAt(Val.ToString(), nullptr, Idx, true, StringParams); })
 					]
@@ -3344,7 +3370,7 @@ FHoudiniParameterDetails::CreateWidgetColor(IDetailCategoryBuilder & HouParamete
 	VerticalBox->AddSlot().Padding(2, 2, 5, 2)
 	[
 		SAssignNew(ColorBlock, SColorBlock)
-		.Color(MainParam->GetColorValue())
+		.Color_Lambda([MainParam]() { return MainParam->GetColorValue(); })
 		.ShowBackgroundForAlpha(bHasAlpha)
 		.OnMouseButtonDown(FPointerEventHandler::CreateLambda(
 		[MainParam, ColorParams, ColorBlock, bHasAlpha](const FGeometry & MyGeometry, const FPointerEvent & MouseEvent)
@@ -5625,15 +5651,17 @@ FHoudiniParameterDetails::CreateWidgetFolder(IDetailCategoryBuilder & HouParamet
 				return;
 		}
 	
-		bool bShown = ParentMultiParm->IsShown();
+		// Folders of instances that are not displayed don't create any widget
+		const bool bInstanceShown = ParentMultiParm->IsShown() && IsMultiParmInstanceDisplayed(ParentMultiParm, AllFoldersAndFolderLists[MainParam->GetParentParmId()]);
+		bool bShown = bInstanceShown;
 
 		// Case 1-1: The folder is NOT tabs
 		if (!MainParam->IsTab())
 		{
 			bShown = MainParam->IsExpanded() && bShown;
 
-			// If the parent multiparm is shown.
-			if (ParentMultiParm->IsShown())
+			// If the parent multiparm instance is shown.
+			if (bInstanceShown)
 			{
 				FDetailWidgetRow* FolderHeaderRow = CreateNestedRow(HouParameterCategory, InParams, false);
 				CreateFolderHeaderUI(FolderHeaderRow, InParams);
@@ -5642,12 +5670,12 @@ FHoudiniParameterDetails::CreateWidgetFolder(IDetailCategoryBuilder & HouParamet
 		// Case 1-2: The folder IS tabs.
 		else 
 		{
-			CreateWidgetTab(HouParameterCategory, MainParam, ParentMultiParm->IsShown());
+			CreateWidgetTab(HouParameterCategory, MainParam, bInstanceShown);
 		}
 
 		// Push the folder to the queue if it is not a tab folder
 		// This step is handled by CreateWidgetTab() if it is tabs
-		if ((!MainParam->IsTab() || !ParentMultiParm->IsShown()) && MainParam->GetTupleSize() > 0)
+		if ((!MainParam->IsTab() || !bInstanceShown) && MainParam->GetTupleSize() > 0)
 		{
 			TArray<UHoudiniParameterFolder*> & MyQueue = FolderStack.Last();
 			MainParam->SetIsContentShown(bShown);
@@ -6024,7 +6052,6 @@ FHoudiniParameterDetails::CreateWidgetMultiParm(IDetailCategoryBuilder & HouPara
 	// Add multiparm UI.
 	TSharedRef<SHorizontalBox> HorizontalBox = SNew(SHorizontalBox);
 	TSharedPtr< SNumericEntryBox< int32 > > NumericEntryBox;
-	int32 NumericalCount = MainParam->MultiParmInstanceCount;
 	HorizontalBox->AddSlot().Padding(2, 2, 5, 2)
 		[
 			SAssignNew(NumericEntryBox, SNumericEntryBox< int32 >)
@@ -6034,7 +6061,13 @@ FHoudiniParameterDetails::CreateWidgetMultiParm(IDetailCategoryBuilder & HouPara
 		.OnValueChanged(SNumericEntryBox<int32>::FOnValueChanged::CreateLambda([OnInstanceValueChangedLambda](int32 InValue) {
 				OnInstanceValueChangedLambda(InValue);
 		}))
-		.Value(NumericalCount)
+		.Value_Lambda([MainParam]()
+		{
+			if (!MainParam || MainParam->IsPendingKill())
+				return TOptional<int32>();
+
+			return TOptional<int32>((int32)MainParam->MultiParmInstanceCount);
+		})
 		];
 
 	HorizontalBox->AddSlot().AutoWidth().Padding(2.0f, 0.0f)
@@ -6152,6 +6185,29 @@ FHoudiniParameterDetails::CreateWidgetMultiParm(IDetailCategoryBuilder & HouPara
 				LOCTEXT("HoudiniParameterRemoveAllMultiparmInstancesToolTip", "Remove all instances"), true)
 		];
 
+	// Large multiparms only display their first instances, let the user display all of them on demand
+	const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	const int32 MaxDisplayedInstances = HoudiniRuntimeSettings ? HoudiniRuntimeSettings->MaxDisplayedMultiParmInstances : 0;
+	if (MaxDisplayedInstances > 0 && !MainParam->IsShowingAllInstances() && (int32)MainParam->MultiParmInstanceCount > MaxDisplayedInstances)
+	{
+		HorizontalBox->AddSlot().AutoWidth().Padding(2.0f, 0.0f).VAlign(VAlign_Center)
+		[
+			SNew(SButton)
+			.Text(FText::Format(LOCTEXT("HoudiniParameterMultiParmShowAllInstances", "Show All ({0})"), FText::AsNumber(MainParam->MultiParmInstanceCount)))
+			.ToolTipText(FText::Format(LOCTEXT("HoudiniParameterMultiParmShowAllInstancesToolTip", "Only the first {0} instances are displayed, click to display all of them."), FText::AsNumber(MaxDisplayedInstances)))
+			.OnClicked_Lambda([MainParam]()
+			{
+				if (!MainParam || MainParam->IsPendingKill())
+					return FReply::Handled();
+
+				MainParam->SetShowAllInstances(true);
+				FHoudiniEngineUtils::UpdateEditorProperties(MainParam, true);
+
+				return FReply::Handled();
+			})
+		];
+	}
+
 	Row->ValueWidget.Widget = HorizontalBox;
 	Row->ValueWidget.MinDesiredWidth(HAPI_UNREAL_DESIRED_ROW_VALUE_WIDGET_WIDTH);
 }
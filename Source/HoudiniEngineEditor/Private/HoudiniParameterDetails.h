@@ -405,6 +405,10 @@ class FHoudiniParameterDetails : public TSharedFromThis<FHoudiniParameterDetails
 
 		FDetailWidgetRow* CreateNestedRow(IDetailCategoryBuilder & HouParameterCategory, TArray<UHoudiniParameter*> InParams, bool bDecreaseChildCount = true); //
 
+		// Indicates if the multiparm instance containing InInstanceParam should be displayed.
+		// Only the first MaxDisplayedMultiParmInstances instances create widgets, unless the multiparm shows all its instances.
+		bool IsMultiParmInstanceDisplayed(const UHoudiniParameterMultiParm* InMultiParm, const UHoudiniParameter* InInstanceParam) const;
+
 		void CreateFolderHeaderUI(FDetailWidgetRow* HeaderRow, TArray<UHoudiniParameter*>& InParams); //
 
 		void CreateWidgetTab(IDetailCategoryBuilder & HouParameterCategory, UHoudiniParameterFolder* InParam, const bool& bIsShown);  //
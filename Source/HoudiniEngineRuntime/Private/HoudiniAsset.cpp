@@ -29,11 +29,14 @@
 
 #include "Misc/Paths.h"
 #include "HAL/UnrealMemory.h"
+#include "Hash/CityHash.h"
 
 UHoudiniAsset::UHoudiniAsset(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
 	, AssetFileName(TEXT(""))
 	, AssetBytesCount(0)	
+	, AssetBytesHash(0)
+	, bAssetBytesHashValid(false)
 	, bAssetLimitedCommercial(false)
 	, bAssetNonCommercial(false)
 	, bAssetExpanded(false)
@@ -44,6 +47,10 @@ UHoudiniAsset::CreateAsset(const uint8 * BufferStart, const uint8 * BufferEnd, c
 {
 	AssetFileName = InFileName;
 
+	// The parameter interface might have changed
+	ParameterTemplates.Empty();
+	bAssetBytesHashValid = false;
+
 	// Calculate buffer size.
 	AssetBytesCount = BufferEnd - BufferStart;
 
@@ -108,11 +115,26 @@ UHoudiniAsset::GetAssetBytesCount() const
 	return AssetBytesCount;
 }
 
+uint64
+UHoudiniAsset::GetAssetBytesHash()
+{
+	if (!bAssetBytesHashValid)
+	{
+		AssetBytesHash = CityHash64(reinterpret_cast<const char *>(AssetBytes.GetData()), AssetBytes.Num());
+		bAssetBytesHashValid = true;
+	}
+
+	return AssetBytesHash;
+}
+
 void
 UHoudiniAsset::Serialize(FArchive & Ar)
 {
 	// Serializes our UProperties
 	Super::Serialize(Ar);
+
+	if (Ar.IsLoading())
+		bAssetBytesHashValid = false;
 	Ar.UsingCustomVersion(FHoudiniCustomSerializationVersion::GUID);
 
 	// Get the version
@@ -30,6 +30,7 @@
 #include "HoudiniAsset.generated.h"
 
 class UAssetImportData;
+class UHoudiniParameter;
 
 UCLASS(BlueprintType, EditInlineNew, config = Engine)
 class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
@@ -55,6 +56,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 		// Return the size in bytes of raw Houdini OTL data.
 		uint32 GetAssetBytesCount() const;
 
+		// Return a hash of the raw Houdini OTL data, computed on first use.
+		uint64 GetAssetBytesHash();
+
 		// Return true if this asset is a limited commercial asset.
 		bool IsAssetLimitedCommercial() const;
 
@@ -80,6 +84,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 		UAssetImportData * AssetImportData;
 #endif
 
+		// Copy of the parameters of a cooked instance of this asset,
+		// used to initialize the parameters of its new instances
+		UPROPERTY(Transient)
+		TArray<UHoudiniParameter*> ParameterTemplates;
+
 	private:
 
 		// Buffer containing the raw HDA OTL data.
@@ -90,6 +99,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAsset : public UObject
 		UPROPERTY()
 		uint32 AssetBytesCount;
 
+		// Hash of the raw HDA data, only valid if bAssetBytesHashValid is true.
+		uint64 AssetBytesHash;
+
+		// Indicates if AssetBytesHash has been computed for the current raw HDA data.
+		bool bAssetBytesHashValid;
+
 		// Indicates if this is a limited commercial asset.
 		UPROPERTY()
 		bool bAssetLimitedCommercial;
@@ -883,6 +883,21 @@ UHoudiniAssetComponent::NeedUpdateParameters() const
 	return false;
 }
 
+double
+UHoudiniAssetComponent::GetLastParameterChangeTime() const
+{
+	double LastChangeTime = 0.0;
+	for (auto CurrentParm : Parameters)
+	{
+		if (!CurrentParm || CurrentParm->IsPendingKill())
+			continue;
+
+		LastChangeTime = FMath::Max(LastChangeTime, CurrentParm->GetLastChangeTime());
+	}
+
+	return LastChangeTime;
+}
+
 bool 
 UHoudiniAssetComponent::NeedUpdateInputs() const
 {
@@ -278,6 +278,9 @@ public:
 	bool NeedUpdateParameters() const;
 	bool NeedUpdateInputs() const;
 
+	// Returns the last time one of the parameters was marked as changed
+	double GetLastParameterChangeTime() const;
+
 	// Returns true if the component has any previous baked output recorded in its outputs
 	bool HasPreviousBakeOutput() const;
 
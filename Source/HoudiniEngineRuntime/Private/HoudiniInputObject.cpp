@@ -1234,6 +1234,36 @@ UHoudiniInputLandscape::Update(UObject * InObject)
 	}
 }
 
+void
+UHoudiniInputLandscape::InvalidateData()
+{
+	// The cached heightfield nodes are about to be deleted
+	HeightfieldCache.Reset();
+
+	Super::InvalidateData();
+}
+
+void
+FHoudiniLandscapeHeightfieldCache::Reset()
+{
+	HeightfieldNodeId = -1;
+	HeightVolumeNodeId = -1;
+	MaskVolumeNodeId = -1;
+
+	MinX = 0;
+	MinY = 0;
+	MaxX = 0;
+	MaxY = 0;
+	ComponentSizeQuads = 0;
+
+	LandscapeTransform = FTransform::Identity;
+
+	HeightComponentHashes.Empty();
+	ExportedLayerNames.Empty();
+	LayerVolumeNodeIds.Empty();
+	LayerComponentHashes.Empty();
+}
+
 EHoudiniInputObjectType
 UHoudiniInputObject::GetInputObjectTypeFromObject(UObject* InObject)
 {
@@ -597,6 +597,42 @@ public:
 //-----------------------------------------------------------------------------------------------------------------------------
 // ALandscapeProxy input
 //-----------------------------------------------------------------------------------------------------------------------------
+
+// Data kept from the last heightfield export of a landscape input.
+// Used to only upload the regions/layers of the landscape that were modified since then.
+// Node ids and hashes are only valid for the current session, so this is not serialized.
+struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeHeightfieldCache
+{
+	void Reset();
+
+	// Heightfield nodes created for the export
+	int32 HeightfieldNodeId = -1;
+	int32 HeightVolumeNodeId = -1;
+	int32 MaskVolumeNodeId = -1;
+
+	// Exported landscape extents, in landscape quads
+	int32 MinX = 0;
+	int32 MinY = 0;
+	int32 MaxX = 0;
+	int32 MaxY = 0;
+	int32 ComponentSizeQuads = 0;
+
+	// Landscape transform used when converting the height values
+	FTransform LandscapeTransform = FTransform::Identity;
+
+	// Hash of the height data for each landscape component (row major, X first)
+	TArray<uint32> HeightComponentHashes;
+
+	// Name of all the layers extracted by the export, in order, including the ones that failed to upload
+	TArray<FString> ExportedLayerNames;
+
+	// Volume node created for each successfully uploaded layer
+	TMap<FString, int32> LayerVolumeNodeIds;
+
+	// Hash of each layer's data for each landscape component
+	TMap<FString, TArray<uint32>> LayerComponentHashes;
+};
+
 UCLASS()
 class HOUDINIENGINERUNTIME_API UHoudiniInputLandscape : public UHoudiniInputActor
 {
@@ -617,9 +653,18 @@ public:
 
 	void SetLandscapeProxy(UObject* InLandscapeProxy);
 
+	virtual void InvalidateData() override;
+
 	// Used to restore an input landscape's transform to its original state
 	UPROPERTY()
 	FTransform CachedInputLandscapeTraqnsform;
+
+	// Cache file the input landscape's data was backed up to, used to restore it
+	UPROPERTY()
+	FString BackupCacheFile;
+
+	// Data from the last heightfield export, used for incremental updates
+	FHoudiniLandscapeHeightfieldCache HeightfieldCache;
 };
 
 
@@ -35,11 +35,19 @@
 
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "HAL/IConsoleManager.h"
 
 #include "Internationalization/Internationalization.h"
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE 
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineInstancedActorPoolSize(
+	TEXT("HoudiniEngine.InstancedActorPoolSize"),
+	1024,
+	TEXT("Maximum number of unused actors kept hidden by each instanced actor component so they can be reused by later cooks.\n")
+	TEXT("0: Disable pooling, unused actors are destroyed\n")
+);
+
 UHoudiniInstancedActorComponent::UHoudiniInstancedActorComponent( const FObjectInitializer& ObjectInitializer )
 : Super( ObjectInitializer )
 , InstancedObject( nullptr )
@@ -112,6 +120,7 @@ UHoudiniInstancedActorComponent::Serialize(FArchive& Ar)
 void UHoudiniInstancedActorComponent::OnComponentDestroyed( bool bDestroyingHierarchy )
 {
     ClearAllInstances();
+    ClearPooledActors();
     Super::OnComponentDestroyed( bDestroyingHierarchy );
 }
 
@@ -126,6 +135,7 @@ UHoudiniInstancedActorComponent::AddReferencedObjects(UObject * InThis, FReferen
             Collector.AddReferencedObject( ThisHIAC->InstancedObject, ThisHIAC );
 
         Collector.AddReferencedObjects(ThisHIAC->InstancedActors, ThisHIAC );
+        Collector.AddReferencedObjects(ThisHIAC->PooledActors, ThisHIAC );
     }
 }
 
@@ -179,7 +189,7 @@ UHoudiniInstancedActorComponent::ClearAllInstances()
     for ( AActor* Instance : InstancedActors )
     {
         if ( Instance && !Instance->IsPendingKill() )
-            Instance->Destroy();
+            ReleaseActorToPool( Instance );
     }
     InstancedActors.Empty();
 }
@@ -193,11 +203,11 @@ UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNu
 	// If we want less instances than we already have, destroy the extra properly
 	if (NewInstanceNum < OldInstanceNum)
 	{
-		for (int32 Idx = NewInstanceNum - 1; Idx < InstancedActors.Num(); Idx++)
+		for (int32 Idx = NewInstanceNum; Idx < InstancedActors.Num(); Idx++)
 		{
 			AActor* Instance = InstancedActors.IsValidIndex(Idx) ? InstancedActors[Idx] : nullptr;
 			if (Instance && !Instance->IsPendingKill())
-				Instance->Destroy();
+				ReleaseActorToPool(Instance);
 		}
 	}
 	
@@ -206,6 +216,75 @@ UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNu
 }
 
 
+void
+UHoudiniInstancedActorComponent::SetInstancedObject(UObject* InObject)
+{
+	if (InObject == InstancedObject)
+		return;
+
+	// The pooled actors were created for the previous object and can't be reused
+	ClearPooledActors();
+	InstancedObject = InObject;
+}
+
+
+void
+UHoudiniInstancedActorComponent::ReleaseActorToPool(AActor* InActor)
+{
+	if (!InActor || InActor->IsPendingKill())
+		return;
+
+	if (!InstancedObject || InstancedObject->IsPendingKill() || PooledActors.Num() >= CVarHoudiniEngineInstancedActorPoolSize.GetValueOnAnyThread())
+	{
+		InActor->Destroy();
+		return;
+	}
+
+	// Park the actor: hide it and disable its collisions until it is reused
+	InActor->SetActorHiddenInGame(true);
+	InActor->SetActorEnableCollision(false);
+#if WITH_EDITOR
+	InActor->SetIsTemporarilyHiddenInEditor(true);
+#endif
+
+	PooledActors.Add(InActor);
+}
+
+
+AActor*
+UHoudiniInstancedActorComponent::AcquirePooledActor()
+{
+	// Use the most recently pooled actors first
+	while (PooledActors.Num() > 0)
+	{
+		AActor* PooledActor = PooledActors.Pop(false);
+		if (!PooledActor || PooledActor->IsPendingKill())
+			continue;
+
+		PooledActor->SetActorHiddenInGame(false);
+		PooledActor->SetActorEnableCollision(true);
+#if WITH_EDITOR
+		PooledActor->SetIsTemporarilyHiddenInEditor(false);
+#endif
+		return PooledActor;
+	}
+
+	return nullptr;
+}
+
+
+void
+UHoudiniInstancedActorComponent::ClearPooledActors()
+{
+	for (AActor* PooledActor : PooledActors)
+	{
+		if (PooledActor && !PooledActor->IsPendingKill())
+			PooledActor->Destroy();
+	}
+	PooledActors.Empty();
+}
+
+
 void 
 UHoudiniInstancedActorComponent::OnComponentCreated()
 {
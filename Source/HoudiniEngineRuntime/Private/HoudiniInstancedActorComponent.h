@@ -47,8 +47,8 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 
 		static void AddReferencedObjects( UObject * InThis, FReferenceCollector & Collector );
 
-		// Object mutator
-		void SetInstancedObject(class UObject* InObject) { InstancedObject = InObject; }
+		// Object mutator, the pooled actors are destroyed if the object changes
+		void SetInstancedObject(class UObject* InObject);
 		// Object accessor
 		class UObject* GetInstancedObject() const { return InstancedObject; }
 		
@@ -70,13 +70,19 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 		// Updates the transform for a given actor. Transform is given in local space of this component.
 		bool SetInstanceTransformAt(const int32& Idx, const FTransform& InstanceTransform);
     
-		// Destroy all existing instances
+		// Remove all existing instances, their actors are moved to the pool
 		void ClearAllInstances();
 
 		// Sets the number of instances needed
-		// Properly deletes extras, new instance actors are nulled 
+		// Extras are moved to the pool, new instance actors are nulled 
 		void SetNumberOfInstances(const int32& NewInstanceNum);
 
+		// Returns an unused actor previously created for the instanced object, or null if the pool has none
+		AActor* AcquirePooledActor();
+
+		// Destroy all the pooled actors
+		void ClearPooledActors();
+
 		// Set the instances. Transforms are given in local space of this component.
 		bool SetInstanceTransforms(const TArray<FTransform>& InstanceTransforms);
   
@@ -88,4 +94,13 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 		UPROPERTY(VisibleInstanceOnly, Category = Instances )
 		TArray<AActor*> InstancedActors;
 
+		// Hides an unused actor and keeps it so it can be reused by a later cook
+		// Actors are destroyed instead when the pool is full
+		void ReleaseActorToPool(AActor* InActor);
+
+		// Unused actors created for the instanced object, hidden until they are reused by an instance.
+		// They are destroyed before the world is saved.
+		UPROPERTY(Transient, DuplicateTransient)
+		TArray<AActor*> PooledActors;
+
 };
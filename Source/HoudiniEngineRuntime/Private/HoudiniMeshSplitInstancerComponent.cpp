@@ -33,6 +33,7 @@
 #include "Serialization/CustomVersion.h"
 
 #include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 
 /*
 #if WITH_EDITOR
@@ -140,6 +141,17 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
     // Destroy previous instances while keeping some of the one that we'll be able to reuse
     ClearInstances(InstanceTransforms.Num());
 
+	// Grouped instanced static mesh components can't be reused for single instances
+	for (int32 iIns = Instances.Num() - 1; iIns >= 0; iIns--)
+	{
+		UStaticMeshComponent* SMC = Instances[iIns];
+		if (!SMC || !SMC->IsA<UInstancedStaticMeshComponent>())
+			continue;
+
+		SMC->ConditionalBeginDestroy();
+		Instances.RemoveAt(iIns);
+	}
+
 	//
     if( !InstancedMesh || InstancedMesh->IsPendingKill() )
     {
@@ -213,6 +225,107 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 	return true;
 }
 
+bool
+UHoudiniMeshSplitInstancerComponent::SetGroupedInstanceTransforms(
+	const TArray<FTransform>& InstanceTransforms, const TArray<int32>& InstanceGroups)
+{
+	if (Instances.Num() <= 0 && InstanceTransforms.Num() <= 0)
+		return false;
+
+	if (!GetOwner() || GetOwner()->IsPendingKill())
+		return false;
+
+	if (InstanceGroups.Num() != InstanceTransforms.Num())
+		return false;
+
+	if (!InstancedMesh || InstancedMesh->IsPendingKill())
+	{
+		HOUDINI_LOG_ERROR(TEXT("%s: Null InstancedMesh for split instanced mesh override"), *GetOwner()->GetName());
+		return false;
+	}
+
+	// Gather the transforms of each group
+	int32 NumGroups = 0;
+	for (const int32& Group : InstanceGroups)
+		NumGroups = FMath::Max(NumGroups, Group + 1);
+
+	TArray<TArray<FTransform>> GroupTransforms;
+	GroupTransforms.SetNum(NumGroups);
+	TArray<int32> GroupFirstInstances;
+	GroupFirstInstances.Init(INDEX_NONE, NumGroups);
+	for (int32 iIns = 0; iIns < InstanceTransforms.Num(); iIns++)
+	{
+		const int32& Group = InstanceGroups[iIns];
+		if (!GroupTransforms.IsValidIndex(Group))
+			continue;
+
+		GroupTransforms[Group].Add(InstanceTransforms[iIns]);
+		if (GroupFirstInstances[Group] == INDEX_NONE)
+			GroupFirstInstances[Group] = iIns;
+	}
+
+	// Destroy previous instances while keeping some of the one that we'll be able to reuse
+	ClearInstances(NumGroups);
+
+	// Only reuse the previous instanced static mesh components
+	for (int32 iGroup = 0; iGroup < Instances.Num(); iGroup++)
+	{
+		UStaticMeshComponent* SMC = Instances[iGroup];
+		if (SMC && !SMC->IsPendingKill() && SMC->IsA<UInstancedStaticMeshComponent>())
+			continue;
+
+		if (SMC)
+			SMC->ConditionalBeginDestroy();
+		Instances[iGroup] = nullptr;
+	}
+
+	Instances.SetNumZeroed(NumGroups);
+	for (int32 iGroup = 0; iGroup < NumGroups; iGroup++)
+	{
+		UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(Instances[iGroup]);
+		if (!ISMC)
+		{
+			ISMC = NewObject<UInstancedStaticMeshComponent>(
+				GetOwner(), UInstancedStaticMeshComponent::StaticClass(), NAME_None, RF_Transactional);
+
+			Instances[iGroup] = ISMC;
+			GetOwner()->AddInstanceComponent(ISMC);
+		}
+
+		// Attach created component to this thing
+		ISMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+		ISMC->SetRelativeTransform(FTransform::Identity);
+
+		ISMC->SetStaticMesh(InstancedMesh);
+		ISMC->SetVisibility(IsVisible());
+		ISMC->SetMobility(Mobility);
+
+		// Use the override material of the group's first instance
+		UMaterialInterface* MI = nullptr;
+		if (OverrideMaterials.Num() > 0)
+		{
+			if (OverrideMaterials.IsValidIndex(GroupFirstInstances[iGroup]))
+				MI = OverrideMaterials[GroupFirstInstances[iGroup]];
+			else
+				MI = OverrideMaterials[0];
+		}
+
+		if (MI && !MI->IsPendingKill())
+		{
+			int32 MeshMaterialCount = InstancedMesh->StaticMaterials.Num();
+			for (int32 Idx = 0; Idx < MeshMaterialCount; ++Idx)
+				ISMC->SetMaterial(Idx, MI);
+		}
+
+		ISMC->ClearInstances();
+		ISMC->AddInstances(GroupTransforms[iGroup], false);
+
+		ISMC->RegisterComponent();
+	}
+
+	return true;
+}
+
 void 
 UHoudiniMeshSplitInstancerComponent::ClearInstances(int32 NumToKeep)
 {
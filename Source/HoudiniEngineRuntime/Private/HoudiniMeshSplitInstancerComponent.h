@@ -66,6 +66,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniMeshSplitInstancerComponent : public USce
 
 		// Set the instances. Transforms are given in local space of this component.
 		bool SetInstanceTransforms(const TArray<FTransform>& InstanceTransforms);
+
+		// Set the instances, using one instanced static mesh component per group of instances.
+		// InstanceGroups contains the group index of each instance, groups use the override material of their first instance.
+		// Transforms are given in local space of this component.
+		bool SetGroupedInstanceTransforms(const TArray<FTransform>& InstanceTransforms, const TArray<int32>& InstanceGroups);
     		
 		// Instance Accessor
 		TArray<class UStaticMeshComponent*>& GetInstancesForWrite() { return Instances; }		
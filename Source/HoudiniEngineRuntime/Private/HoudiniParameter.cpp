@@ -34,6 +34,7 @@ UHoudiniParameter::UHoudiniParameter(const FObjectInitializer & ObjectInitialize
 	, ParmId(-1)
 	, ParentParmId(-1)
 	, ChildIndex(-1)
+	, InstanceNum(-1)
 	, bIsVisible(true)
 	, bIsDisabled(false)
 	, bHasChanged(false)
@@ -112,12 +112,14 @@ public:
 	virtual int32 GetParmId() const { return ParmId; };
 	virtual int32 GetParentParmId() const { return ParentParmId; };
 	virtual int32 GetChildIndex() const { return ChildIndex; };
+	virtual int32 GetInstanceNum() const { return InstanceNum; };
 
 	virtual bool IsVisible() const { return bIsVisible; };
 	virtual bool ShouldDisplay() const{ return bIsVisible && ParmType != EHoudiniParameterType::Invalid; };
 	virtual bool IsDisabled() const { return bIsDisabled; };
 	virtual bool HasChanged() const { return bHasChanged; };
 	virtual bool NeedsToTriggerUpdate() const { return bNeedsToTriggerUpdate; };
+	double GetLastChangeTime() const { return LastChangeTime; };
 	virtual bool IsDefault() const { return true; };
 	virtual bool IsSpare() const { return bIsSpare; };
 	virtual bool GetJoinNext() const { return bJoinNext; };
@@ -152,6 +154,7 @@ public:
 	virtual void SetParmId(const int32& InParmId) { ParmId = InParmId; };
 	virtual void SetParentParmId(const int32& InParentParmId) { ParentParmId = InParentParmId; };
 	virtual void SetChildIndex(const int32& InChildIndex) { ChildIndex = InChildIndex; };
+	virtual void SetInstanceNum(const int32& InInstanceNum) { InstanceNum = InInstanceNum; };
 
 	virtual void SetIsChildOfMultiParm(const bool& IsChildOfMultiParam) { bIsChildOfMultiParm = IsChildOfMultiParam; };
 	virtual bool GetIsChildOfMultiParm() const { return bIsChildOfMultiParm; };
@@ -168,7 +171,7 @@ public:
 	virtual void SetTagCount(const uint32& InTagCount) { TagCount = InTagCount; };
 	virtual void SetValueIndex(const uint32& InValueIndex) { ValueIndex = InValueIndex; };
 
-	virtual void MarkChanged(const bool& bInChanged) { bHasChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); };
+	virtual void MarkChanged(const bool& bInChanged) { bHasChanged = bInChanged; SetNeedsToTriggerUpdate(bInChanged); if (bInChanged) LastChangeTime = FPlatformTime::Seconds(); };
 	virtual void SetNeedsToTriggerUpdate(const bool& bInTriggersUpdate) { bNeedsToTriggerUpdate = bInTriggersUpdate; };
 	virtual void RevertToDefault();
 	virtual void RevertToDefault(const int32& TupleIndex);
@@ -244,6 +247,10 @@ protected:
 	UPROPERTY()
 	int32 ChildIndex;
 
+	// Instance number within its parent multiparm, -1 if not in a multiparm.
+	UPROPERTY()
+	int32 InstanceNum;
+
 	// 
 	UPROPERTY()
 	bool bIsVisible;
@@ -319,6 +326,9 @@ protected:
 	UPROPERTY()
 	bool bAutoUpdate = true;
 
+	// Time at which the parameter was last marked as changed, used to delay cooks while it is being modified
+	double LastChangeTime = 0.0;
+
 
 };
 
@@ -27,7 +27,7 @@
 #include "HoudiniParameterMultiParm.h"
 
 UHoudiniParameterMultiParm::UHoudiniParameterMultiParm(const FObjectInitializer & ObjectInitializer)
-	: Super(ObjectInitializer), bIsShown(false), InstanceStartOffset(0)
+	: Super(ObjectInitializer), bIsShown(false), bShowAllInstances(false), InstanceStartOffset(0)
 {
 	// TODO Proper Init
 	ParmType = EHoudiniParameterType::MultiParm;
@@ -70,6 +70,12 @@ public:
 	FORCEINLINE
 	bool IsShown() const { return bIsShown; };
 
+	FORCEINLINE
+	void SetShowAllInstances(const bool InShowAllInstances) { bShowAllInstances = InShowAllInstances; };
+
+	FORCEINLINE
+	bool IsShowingAllInstances() const { return bShowAllInstances; };
+
 
 	/** Increment value, used by Slate. **/
 	void InsertElement();
@@ -85,6 +91,10 @@ public:
 	UPROPERTY()
 	bool bIsShown;
 
+	// Indicates that all the instances should be displayed, regardless of MaxDisplayedMultiParmInstances
+	UPROPERTY()
+	bool bShowAllInstances;
+
 	// Value of the multiparm
 	UPROPERTY()
 	int32 Value;
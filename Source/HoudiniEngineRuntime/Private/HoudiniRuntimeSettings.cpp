@@ -55,15 +55,19 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 
 	// Instantiating options.
 	bShowMultiAssetDialog = true;
+	bPreloadAssetLibrariesOnSessionStart = false;
 
 	// Cooking options.
 	bPauseCookingOnStart = false;
 	bDisplaySlateCookingNotifications = true;
+	CookDebounceTime = 0.0f;
+	bInterruptCookOnParameterChange = false;
 	DefaultTemporaryCookFolder = HAPI_UNREAL_DEFAULT_TEMP_COOK_FOLDER;
 	DefaultBakeFolder = HAPI_UNREAL_DEFAULT_BAKE_FOLDER;
 
 	// Parameter options
 	//bTreatRampParametersAsMultiparms = false;
+	MaxDisplayedMultiParmInstances = 32;
 
 	// Custom Houdini location.
 	bUseCustomHoudiniLocation = false;
@@ -78,10 +82,15 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	MarshallingLandscapesForceMinMaxValues = false;
 	MarshallingLandscapesForcedMinValue = -2000.0f;
 	MarshallingLandscapesForcedMaxValue = 4553.0f;
+	MarshallingLandscapesResamplingMode = EHoudiniLandscapeResamplingMode::Bilinear;
 
 	// Spline marshalling
 	MarshallingSplineResolution = 50.0f;
 
+	// Instancer marshalling
+	MarshallingInstancerCellSize = 0.0f;
+	MarshallingGroupSplitInstances = false;
+
 	// Static mesh proxy refinement settings
 	bEnableProxyStaticMesh = false;
 	bShowDefaultMesh = true;
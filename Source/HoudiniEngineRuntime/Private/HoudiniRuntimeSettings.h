@@ -50,6 +50,19 @@ enum EHoudiniRuntimeSettingsSessionType
 	HRSST_MAX
 };
 
+UENUM()
+enum class EHoudiniLandscapeResamplingMode : uint8
+{
+	// Fastest, but can soften the terrain's details.
+	Bilinear,
+
+	// Catmull-Rom bicubic filter, keeps more details.
+	Bicubic,
+
+	// Lanczos (3 lobes) filter, sharpest result but slowest.
+	Lanczos
+};
+
 UCLASS(config = Engine, defaultconfig)
 class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
 {
@@ -133,6 +146,10 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Instantiating)
 		bool bShowMultiAssetDialog;
 
+		// Whether the HDAs used by the Houdini Assets of the opened levels should be loaded when a session is started, instead of when they are instantiated.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Instantiating)
+		bool bPreloadAssetLibrariesOnSessionStart;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Cooking options.		
 		//-------------------------------------------------------------------------------------------------------------
@@ -145,6 +162,15 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		bool bDisplaySlateCookingNotifications;
 
+		// Time (in seconds) to wait after an asset has been modified before starting its cook.
+		// Changes made during that time are cooked together, using only their latest values.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking, meta = (ClampMin = "0.0", UIMin = "0.0", UIMax = "1.0"))
+		float CookDebounceTime;
+
+		// Whether a running cook should be interrupted when an asset's parameters are modified, so their new values are cooked sooner.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
+		bool bInterruptCookOnParameterChange;
+
 		// Default content folder storing all the temporary cook data (Static meshes, materials, textures, landscape layer infos...)
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Cooking)
 		FString DefaultTemporaryCookFolder;
@@ -163,6 +189,11 @@ protected:
 		bool bTreatRampParametersAsMultiparms;
 		*/
 
+		// Maximum number of multiparm instances displayed in the details panel before requiring them to be expanded, 0 displays all instances.
+		// Limiting this keeps the details panel responsive for assets with very large multiparms.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = Parameters, meta = (ClampMin = "0", UIMin = "0", UIMax = "256"))
+		int32 MaxDisplayedMultiParmInstances;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Geometry Marshalling
 		//-------------------------------------------------------------------------------------------------------------
@@ -186,11 +217,25 @@ protected:
 		// The maximum value to be used for Landscape conversion when MarshallingLandscapesForceMinMaxValues is enabled
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
 		float MarshallingLandscapesForcedMaxValue;
+		// Filter used to resample heightfields and their layers when their size doesn't match a valid landscape size
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
+		EHoudiniLandscapeResamplingMode MarshallingLandscapesResamplingMode;
 
 		// Default resolution used when converting Unreal Spline Components to Houdini Curves (step in cm between control points, 0 only send the control points)
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
 		float MarshallingSplineResolution;
 
+		// Size (in cm) of the grid cells used to split large instancers into multiple instanced static mesh components (0 disables the split).
+		// Can be overridden per instancer by the unreal_instancer_cell_size attribute.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
+		float MarshallingInstancerCellSize;
+
+		// If true, split mesh instancers (unreal_split_instances) create one instanced static mesh component per group of
+		// instances sharing the same material and property attribute values, instead of one static mesh component per instance.
+		// Instancers with instance color overrides always use one static mesh component per instance.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
+		bool MarshallingGroupSplitInstances;
+
 		//-------------------------------------------------------------------------------------------------------------
 		// Static Mesh Options
 		//-------------------------------------------------------------------------------------------------------------